@@ -0,0 +1,128 @@
+/**
+ * @file spawn_bench.c
+ * @author Justen Di Ruscio
+ * @brief Compares launching commands with posix_spawn against fork and exec,
+ * the two modes of launchCommand. Each launch runs a short command and waits
+ * for it, as myshell does, and is repeated with more of the parent's memory
+ * resident, since fork copies the page tables mapping it. Prints spawns/sec
+ * and us per spawn of each.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <myshell/launch.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_LAUNCHES 2000
+
+// resident memory of the parent, in MiB, each mode is timed with
+static const size_t benchHeapsMiB[] = {0, 64, 512};
+static const size_t numBenchHeaps =
+    sizeof(benchHeapsMiB) / sizeof(benchHeapsMiB[0]);
+
+// ==================== PRIVATE FUNCTIONS ===============
+static uint64_t bench_nowNs(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * @brief Launches argv numLaunches times in mode, waiting on each
+ *
+ * @return uint64_t nanoseconds taken, or 0 upon error
+ */
+static uint64_t bench_launch(char *const argv[], const LaunchMode mode,
+                             const size_t numLaunches) {
+  const uint64_t start = bench_nowNs();
+  for (size_t i = 0; i < numLaunches; ++i) {
+    const pid_t pid = launchCommand((char *)NULL, argv, NULL, mode);
+    if (pid == -1) {
+      perror(argv[0]);
+      return 0;
+    }
+    int status;
+    if (waitpid(pid, &status, 0) == -1 || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != 0) {
+      fprintf(stderr, "%s didn't exit successfully\n", argv[0]);
+      return 0;
+    }
+  }
+  return bench_nowNs() - start;
+}
+
+static void bench_usage(const char *const program) {
+  fprintf(stderr,
+          "usage: %s [--launches N] [COMMAND [ARG...]]\n"
+          "  --launches N  launches timed per mode and heap size; defaults "
+          "to %u\n"
+          "  COMMAND       command to launch, which must exit with 0; "
+          "defaults to true\n",
+          program, BENCH_DEFAULT_LAUNCHES);
+}
+
+// ==================== MAIN ===============
+int main(int argc, char **argv) {
+  size_t numLaunches = BENCH_DEFAULT_LAUNCHES;
+  int argIdx = 1;
+  if (argIdx + 1 < argc && strcmp(argv[argIdx], "--launches") == 0) {
+    numLaunches = strtoul(argv[argIdx + 1], NULL, 10);
+    argIdx += 2;
+  }
+  if (numLaunches == 0 || (argIdx < argc && argv[argIdx][0] == '-')) {
+    bench_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  char *defaultCommand[] = {"true", (char *)NULL};
+  char *const *const command = argIdx < argc ? argv + argIdx : defaultCommand;
+
+  const struct {
+    LaunchMode mode;
+    const char *name;
+  } modes[] = {{LaunchSpawn, "posix_spawn"}, {LaunchFork, "fork"}};
+
+  printf("%-12s %10s %14s %12s\n", "mode", "heap_MiB", "spawns/sec",
+         "us/spawn");
+  char *heap = (char *)NULL;
+  for (size_t hIdx = 0; hIdx < numBenchHeaps; ++hIdx) {
+    // Grow the parent to the heap size and touch every page, so each is
+    // mapped when the children are launched
+    const size_t heapBytes = benchHeapsMiB[hIdx] << 20;
+    free(heap);
+    heap = heapBytes != 0 ? malloc(heapBytes) : (char *)NULL;
+    if (heapBytes != 0 && heap == (char *)NULL) {
+      perror("malloc");
+      return EXIT_FAILURE;
+    }
+    if (heap != (char *)NULL) {
+      memset(heap, 1, heapBytes);
+    }
+
+    for (size_t modeIdx = 0; modeIdx < sizeof(modes) / sizeof(modes[0]);
+         ++modeIdx) {
+      const uint64_t elapsed =
+          bench_launch(command, modes[modeIdx].mode, numLaunches);
+      if (elapsed == 0) {
+        free(heap);
+        return EXIT_FAILURE;
+      }
+      printf("%-12s %10zu %14.0f %12.1f\n", modes[modeIdx].name,
+             benchHeapsMiB[hIdx],
+             (double)numLaunches * 1e9 / (double)elapsed,
+             (double)elapsed / 1e3 / (double)numLaunches);
+    }
+  }
+  free(heap);
+  return EXIT_SUCCESS;
+}
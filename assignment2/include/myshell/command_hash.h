@@ -0,0 +1,52 @@
+#pragma once
+/**
+ * @file command_hash.h
+ * @author Justen Di Ruscio
+ * @brief Cache of the paths system commands were found at in PATH, so each
+ * launch execs the command directly rather than trying every PATH directory.
+ * Like bash's command hash, it's emptied whenever PATH changes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+/**
+ * @brief Finds the path of command name, from the cache or by searching PATH
+ * for an executable regular file and caching where it was found. Names
+ * containing a '/' are paths already and are returned as is. Sets errno upon
+ * error, including ENOENT when name isn't found in PATH.
+ *
+ * @param name command name, argv[0] of the command
+ * @return const char* path to exec, valid until the cache is next modified,
+ * or NULL upon error
+ */
+const char *commandHash_resolve(const char *const name);
+
+/**
+ * @brief Removes name from the cache, such as after its cached path couldn't
+ * be exec'd. Does nothing if name isn't cached.
+ *
+ * @param name command name
+ */
+void commandHash_forget(const char *const name);
+
+/**
+ * @brief Removes every command from the cache
+ *
+ */
+void commandHash_clear(void);
+
+/**
+ * @brief Prints every cached command with its path and the number of times
+ * it was found in the cache, in the format of bash's hash builtin
+ *
+ * @param stream stream to print to
+ * @return true some command was printed
+ * @return false the cache is empty
+ */
+bool commandHash_print(FILE *const stream);
@@ -13,19 +13,45 @@
 
 #include <jd/string.h>
 #include <jd/vector.h>
+#include <myshell/launch.h>
+
+/**
+ * @brief Every internal command, as X(name, first, text, executor): its
+ * CommandName, the first character of its name, its name from the header of
+ * the command, and the function executing it. CommandName and the builtin
+ * and perfect hash tables of commands.c are generated from it, so each
+ * command is added here alone.
+ *
+ */
+#define BUILTIN_COMMANDS(X)                                                  \
+  X(Cd, 'c', CD_COMMAND_NAME, executeCd)                                     \
+  X(Exit, 'e', EXIT_COMMAND_NAME, executeExit)                               \
+  X(Fg, 'f', FG_COMMAND_NAME, executeFg)                                     \
+  X(Bg, 'b', BG_COMMAND_NAME, executeBg)                                     \
+  X(Hash, 'h', HASH_COMMAND_NAME, executeHash)                               \
+  X(Jobs, 'j', JOBS_COMMAND_NAME, executeJobs)                               \
+  X(Source, 's', SOURCE_COMMAND_NAME, executeSource)                         \
+  X(Pipes, 'p', PIPES_COMMAND_NAME, executePipes)                            \
+  X(History, 'h', HISTORY_COMMAND_NAME, executeHistory)                      \
+  X(Time, 't', TIME_COMMAND_NAME, executeTime)
+
+#define COMMAND_NAME_ENUMERATOR(name, first, text, executor) name,
 
 /**
  * @brief Integral value used to indicate which command should be executed by
  * myshell based on user's input. Unknown is not a command name, it indicates
- * the command name is unknown by myshell.
+ * the command name is unknown by myshell. The rest come from
+ * BUILTIN_COMMANDS.
  *
  */
-enum CommandName { Unknown, Cd, Exit, Fg, Bg };
+enum CommandName { Unknown, BUILTIN_COMMANDS(COMMAND_NAME_ENUMERATOR) };
+
+#undef COMMAND_NAME_ENUMERATOR
 
 /**
- * @brief Parses the provided string, comparing it against known myshell
- * commands, returning identified command name contained in string. Sets errno
- * upon error.
+ * @brief Parses the provided string, looking it up among known myshell
+ * commands by a perfect hash, with a single comparison, returning identified
+ * command name contained in string. Sets errno upon error.
  *
  * @param commandName
  * @return enum CommandName
@@ -44,10 +70,12 @@ enum CommandName parseCommandName(const String* const commandName);
 int execInternal(const enum CommandName name, const Vector* const commandArgs);
 
 /**
- * @brief Executes a system command based on the user provided command
- * arguments. Sets errno upon error.
+ * @brief Launches a system command based on the user provided command
+ * arguments as a child process, with launchCommand, from the path cached for
+ * its name by commandHash_resolve. Sets errno upon error.
  *
  * @param cmdArgs Vector of STrings of the separated user provided command args
- * @return int return code of executing the internal command
+ * @param io pipes to connect the command to and its process group, or NULL
+ * @return pid_t PID of the launched command, or -1 upon error
  */
-int execSystem(const Vector* const cmdArgs);
+pid_t execSystem(const Vector* const cmdArgs, const LaunchIo* const io);
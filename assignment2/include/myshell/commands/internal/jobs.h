@@ -0,0 +1,26 @@
+#pragma once
+/**
+ * @file jobs.h
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to list jobs.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <jd/vector.h>
+
+#define JOBS_COMMAND_NAME \
+  "jobs"  // command name as a string expected on the command line
+
+/**
+ * @brief Executes the jobs command
+ *
+ * @param commandName command name as a string for error messages
+ * @param commandArgs Vector of Strings of the separated args provided by user
+ * @return int return code of the command (errno)
+ */
+int executeJobs(const char *const commandName,
+                const Vector *const commandArgs);
@@ -0,0 +1,27 @@
+#pragma once
+/**
+ * @file pipes.h
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to size pipes
+ * and show stats of recent pipelines.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <jd/vector.h>
+
+#define PIPES_COMMAND_NAME \
+  "pipes"  // command name as a string expected on the command line
+
+/**
+ * @brief Executes the pipes command
+ *
+ * @param commandName command name as a string for error messages
+ * @param commandArgs Vector of Strings of the separated args provided by user
+ * @return int return code of the command (errno)
+ */
+int executePipes(const char *const commandName,
+                 const Vector *const commandArgs);
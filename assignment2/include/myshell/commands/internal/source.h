@@ -0,0 +1,27 @@
+#pragma once
+/**
+ * @file source.h
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to run a script
+ * in myshell itself.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <jd/vector.h>
+
+#define SOURCE_COMMAND_NAME \
+  "source"  // command name as a string expected on the command line
+
+/**
+ * @brief Executes the source command
+ *
+ * @param commandName command name as a string for error messages
+ * @param commandArgs Vector of Strings of the separated args provided by user
+ * @return int return code of the command (errno)
+ */
+int executeSource(const char *const commandName,
+                  const Vector *const commandArgs);
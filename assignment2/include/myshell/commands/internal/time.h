@@ -0,0 +1,28 @@
+#pragma once
+/**
+ * @file time.h
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to time every
+ * pipeline, or show whether it does. Single pipelines are timed by the time
+ * keyword starting them instead.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <jd/vector.h>
+
+#define TIME_COMMAND_NAME \
+  "time"  // command name as a string expected on the command line
+
+/**
+ * @brief Executes the time command
+ *
+ * @param commandName command name as a string for error messages
+ * @param commandArgs Vector of Strings of the separated args provided by user
+ * @return int return code of the command (errno)
+ */
+int executeTime(const char *const commandName,
+                const Vector *const commandArgs);
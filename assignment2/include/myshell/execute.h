@@ -0,0 +1,40 @@
+#pragma once
+/**
+ * @file execute.h
+ * @author Justen Di Ruscio
+ * @brief Execution of parsed pipelines and scripts. Each pipeline with system
+ * commands runs as a job, waited on unless it's in the background.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+
+#include <myshell/syntax.h>
+
+/**
+ * @brief Runs each command of pipeline, piping each one's output into the
+ * next one's input. System commands are launched as a job, then waited on if
+ * it's in the foreground; internal commands run in myshell, their output
+ * fed into their pipe without a process of their own. Each command's
+ * redirections are applied after its pipes. Errors of single commands are
+ * reported and skipped. Sets errno upon error.
+ *
+ * @param pipeline pipeline to run
+ * @return true pipeline was run
+ * @return false an error occurred which myshell can't carry on from
+ */
+bool execute_pipeline(const Pipeline *const pipeline);
+
+/**
+ * @brief Runs each pipeline of script in order, as execute_pipeline does.
+ * Sets errno upon error.
+ *
+ * @param script script to run
+ * @return true script was run
+ * @return false an error occurred which myshell can't carry on from
+ */
+bool execute_script(const Script *const script);
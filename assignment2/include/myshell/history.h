@@ -0,0 +1,103 @@
+#pragma once
+/**
+ * @file history.h
+ * @author Justen Di Ruscio
+ * @brief History of command lines, kept in a file appended to by every
+ * session of myshell. The file is mapped into memory and indexed by the
+ * offset of each line, so entries are found without reading it, and lines
+ * appended by other sessions are picked up as the file grows. Entries are
+ * numbered from 1, oldest first.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <jd/string.h>
+
+#define HISTORY_FILE_NAME \
+  ".myshell_history"  // file in the home directory history is kept in
+
+/**
+ * @brief Opens the history file at path, creating it if needed, and indexes
+ * its entries. Until history is opened, it's empty and nothing is added to
+ * it. Sets errno upon error.
+ *
+ * @param path history file
+ * @return true successfully opened history
+ * @return false failed to open history
+ */
+bool history_open(const char *const path);
+
+/**
+ * @brief Appends line to history, unless it's empty or the same as the most
+ * recent entry. Lines are appended whole, so sessions appending at once don't
+ * interleave them. Sets errno upon error.
+ *
+ * @param line command line, without a newline
+ * @return true successfully added line, or line was skipped
+ * @return false failed to add line
+ */
+bool history_add(const StringView line);
+
+/**
+ * @brief Number of entries in history, including those appended by other
+ * sessions so far
+ *
+ * @return size_t number of entries
+ */
+size_t history_count(void);
+
+/**
+ * @brief Finds entry number of history
+ *
+ * @param number entry number, from 1
+ * @return StringView entry, without its newline, or empty if there's no such
+ * entry. Valid until history is next added to, counted or searched, as the
+ * file may be mapped elsewhere once it grows
+ */
+StringView history_entry(const size_t number);
+
+/**
+ * @brief Finds the most recent entry starting with prefix
+ *
+ * @param prefix start of the entry
+ * @return size_t entry number, or 0 if no entry starts with prefix
+ */
+size_t history_findPrefix(const StringView prefix);
+
+/**
+ * @brief Finds the most recent entry before entry number before holding
+ * text, as reverse search does. Searching again before the entry found finds
+ * the next most recent.
+ *
+ * @param text text held by the entry, without newlines
+ * @param before entry number to search before, or past the last entry to
+ * search every entry
+ * @return size_t entry number, or 0 if no such entry holds text
+ */
+size_t history_search(const StringView text, const size_t before);
+
+/**
+ * @brief Expands a history event at the start of line, replacing it with the
+ * entry it refers to: !! for the last entry, !N for entry N, !-N for the Nth
+ * most recent entry and !prefix for the most recent entry starting with
+ * prefix. Expanded lines are printed, as they're run instead of what was
+ * typed. Sets errno upon error, or to ENOENT when there's no such entry,
+ * after reporting it.
+ *
+ * @param line command line to expand
+ * @return true successfully expanded line, or it holds no event
+ * @return false no entry matches the event, or an error occurred
+ */
+bool history_expand(String *const line);
+
+/**
+ * @brief Unmaps and closes the history file
+ *
+ */
+void history_close(void);
@@ -0,0 +1,214 @@
+#pragma once
+/**
+ * @file job_table.h
+ * @author Justen Di Ruscio
+ * @brief Table of the jobs of myshell. Each job is a command line launched as
+ * its own process group, found in constant time by its job id, its process
+ * group ID or the PID of any of its processes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <termios.h>
+#include <time.h>
+
+#include <jd/string.h>
+#include <jd/vector.h>
+
+#define STAGE_NAME_SIZE 16 // of stage names, truncated as the kernel's are
+
+/**
+ * @brief State of a job of myshell
+ *
+ */
+typedef enum JobState {
+  JobForeground, // running, holding the terminal while myshell waits on it
+  JobBackground, // running while myshell takes commands
+  JobSuspended,  // every process stopped, by Ctrl+Z for instance
+  numJobStates
+} JobState;
+
+/**
+ * @brief Resources a process used, known once it exits
+ *
+ */
+typedef struct ProcessUsage {
+  struct rusage usage;             // CPU time, context switches and such
+  unsigned long long bytesRead;    // read through any descriptor, like pipes
+  unsigned long long bytesWritten; // written through any descriptor
+} ProcessUsage;
+
+/**
+ * @brief A process of a job, as a stage of its pipeline
+ *
+ */
+typedef struct Stage {
+  pid_t pid;
+  char name[STAGE_NAME_SIZE]; // command name, without its directory
+  struct timespec launched; // monotonic time the process was added
+  struct timespec reaped;   // monotonic time the process exited, once reaped
+  bool finished;            // whether the process exited and was reaped
+  ProcessUsage usage;       // resources used, once reaped
+} Stage;
+
+/**
+ * @brief A command line, launched as a process group
+ *
+ */
+typedef struct Job {
+  unsigned id;         // from 1, as given to fg and bg with %
+  pid_t pgid;          // process group of every process, led by the first
+  bool grouped;        // whether pgid is a process group, under job control
+  JobState state;      // changed with jobTable_setState
+  size_t numProcesses; // processes not reaped yet
+  size_t numStopped;   // of those, processes stopped
+  pid_t lastPid;       // last process of the pipeline
+  int status;          // wait status of lastPid, once it's reaped
+  Vector stages;       // Stage of every process, reaped or not, in order
+  size_t pipeCapacity; // bytes each pipe between its processes holds
+  size_t bytesFed;     // output of internal commands fed into its pipes
+  double feedStall;    // seconds myshell waited on its full pipes to feed them
+  bool timed;          // whether its stages are reported once it finishes
+  char *command;       // command line the job was launched from
+  bool hasModes;       // whether terminalModes were saved
+  struct termios terminalModes; // terminal modes of the job when stopped
+} Job;
+
+/**
+ * @brief Adds a job without processes, with the lowest id greater than every
+ * job's. Its process group, or its pgid when not grouped, is the first
+ * process added. Sets errno upon error.
+ *
+ * @param command command line the job is launched from, which is copied
+ * @param state initial state of the job
+ * @param grouped whether the job's processes are launched in their own process
+ * group, rather than myshell's
+ * @return Job* new job, valid until it's removed, or NULL upon error
+ */
+Job *jobTable_add(const StringView command, const JobState state,
+                  const bool grouped);
+
+/**
+ * @brief Adds process pid to job, after it's launched in the job's process
+ * group. The first process added leads the group. Sets errno upon error.
+ *
+ * @param job job to add pid to
+ * @param pid PID of the launched process
+ * @param name command pid runs, named by the stage without its directory
+ * @return true successfully added pid
+ * @return false failed to add pid
+ */
+bool jobTable_addProcess(Job *const job, const pid_t pid,
+                         const char *const name);
+
+/**
+ * @brief Records the state change of process pid reported by waitpid,
+ * forgetting pid once it exited, along with the resources it used. The job's
+ * state itself is left to the caller.
+ *
+ * @param pid PID reported by waitpid
+ * @param status wait status reported by waitpid
+ * @param usage resources used by pid if it exited, or NULL if unknown
+ * @return Job* job of pid, or NULL if pid isn't in any
+ */
+Job *jobTable_processChanged(const pid_t pid, const int status,
+                             const ProcessUsage *const usage);
+
+/**
+ * @brief Moves job to state. Jobs leaving JobSuspended have every process
+ * counted as running again, as they're continued with SIGCONT.
+ *
+ * @param job job to move
+ * @param state state job is now in
+ */
+void jobTable_setState(Job *const job, const JobState state);
+
+/**
+ * @brief Sends signal sigNum to every process of job: to its process group,
+ * or else to each of its processes not reaped yet. Sets errno upon error.
+ *
+ * @param job job to signal
+ * @param sigNum signal to send
+ * @return true successfully sent signal
+ * @return false failed to send signal
+ */
+bool jobTable_signal(const Job *const job, const int sigNum);
+
+/**
+ * @brief Removes job, once each of its processes is reaped, and frees it
+ *
+ * @param job job to remove
+ */
+void jobTable_remove(Job *const job);
+
+/**
+ * @brief Finds the job with id
+ *
+ * @param id job id
+ * @return Job* job, or NULL if no job has id
+ */
+Job *jobTable_find(const unsigned id);
+
+/**
+ * @brief Finds the job whose process group is pgid
+ *
+ * @param pgid process group ID
+ * @return Job* job, or NULL if no job has pgid
+ */
+Job *jobTable_findByPgid(const pid_t pgid);
+
+/**
+ * @brief Finds the job process pid is in
+ *
+ * @param pid PID of a process not reaped yet
+ * @return Job* job, or NULL if no job holds pid
+ */
+Job *jobTable_findByPid(const pid_t pid);
+
+/**
+ * @brief Finds the job given on the command line as spec: %N for job id N,
+ * %% or %+ for the current job, or the PID or process group ID of a job
+ *
+ * @param spec job specification
+ * @return Job* job, or NULL if no job matches spec
+ */
+Job *jobTable_findSpec(const char *const spec);
+
+/**
+ * @brief The current job, which fg and bg act on by default: the most recently
+ * suspended or added job not in the foreground, or else the one with the
+ * greatest id
+ *
+ * @return Job* current job, or NULL if no job is outside the foreground
+ */
+Job *jobTable_current(void);
+
+/**
+ * @brief The job with the lowest id of at least id, for iterating every job in
+ * order of id
+ *
+ * @param id lowest id of the job to return
+ * @return Job* job, or NULL if no job's id is at least id
+ */
+Job *jobTable_next(const unsigned id);
+
+/**
+ * @brief Number of jobs in state
+ *
+ * @param state state to count
+ * @return size_t number of jobs in state
+ */
+size_t jobTable_count(const JobState state);
+
+/**
+ * @brief Removes and frees every job
+ *
+ */
+void jobTable_freeData(void);
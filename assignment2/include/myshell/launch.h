@@ -0,0 +1,68 @@
+#pragma once
+/**
+ * @file launch.h
+ * @author Justen Di Ruscio
+ * @brief Launching system commands as child processes of myshell, either with
+ * posix_spawn or by forking and exec'ing
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stddef.h>
+#include <sys/types.h>
+
+/**
+ * @brief How launchCommand creates the child process
+ *
+ */
+typedef enum LaunchMode {
+  LaunchSpawn, // posix_spawn, falling back to fork where it can't run argv
+  LaunchFork   // fork, then exec in the child
+} LaunchMode;
+
+/**
+ * @brief A descriptor of the child made a copy of another, as by dup2, or
+ * closed
+ *
+ */
+typedef struct LaunchFd {
+  int fd;     // descriptor of the child to arrange
+  int source; // descriptor fd becomes a copy of, or -1 to close fd
+} LaunchFd;
+
+/**
+ * @brief File descriptors and process group arranged in the child before it
+ * execs. Descriptors are arranged in order, so a source refers to the child's
+ * descriptor as arranged so far, like the shell's 2>&1 does. Descriptors of
+ * myshell are expected to be close-on-exec, so sources only reach the child
+ * through fds.
+ *
+ */
+typedef struct LaunchIo {
+  const LaunchFd *fds; // descriptors to arrange, in order
+  size_t numFds;       // number of fds
+  pid_t pgid;          // process group to join, 0 to lead a new one, or -1
+  int terminalFd;      // terminal to put the child's process group in front
+                       // of, or -1
+} LaunchIo;
+
+/**
+ * @brief Runs the file at path, or argv[0] searched for in PATH, as a child
+ * process with argv and io, terminal signals and SIGPIPE at their default
+ * action and no signals blocked. LaunchSpawn avoids copying myshell's page
+ * tables by using posix_spawn, but falls back to fork for files posix_spawn
+ * can't exec, like scripts without a #! line, which execvp runs with /bin/sh.
+ * Sets errno upon error, including when the command can't be exec'd by
+ * LaunchSpawn; a forked child instead reports that itself and exits.
+ *
+ * @param path file to exec, or NULL to search PATH for argv[0]
+ * @param argv NULL terminated arguments, including the command name
+ * @param io descriptors to arrange in the child, or NULL to inherit all
+ * @param mode how to create the child
+ * @return pid_t PID of the child, or -1 upon error
+ */
+pid_t launchCommand(const char *const path, char *const argv[],
+                    const LaunchIo *const io, const LaunchMode mode);
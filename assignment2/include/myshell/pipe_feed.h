@@ -0,0 +1,83 @@
+#pragma once
+/**
+ * @file pipe_feed.h
+ * @author Justen Di Ruscio
+ * @brief Output of internal commands fed into the pipe to the next command of
+ * their pipeline, without forking a process to run them. Output is written to
+ * a memory file, then spliced into the pipe, moving its pages rather than
+ * copying them through myshell.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+/**
+ * @brief Output of an internal command, and the pipe it's fed into
+ *
+ */
+typedef struct PipeFeed {
+  int source;    // memory file the command writes its output to, or -1
+  int pipeFd;    // write end of the pipe fed, owned by the feed, or -1
+  off_t offset;  // bytes of source fed so far
+  off_t length;  // bytes written to source, as of the last feed
+  double stalled; // seconds spent waiting for the reader to make room
+} PipeFeed;
+
+/**
+ * @brief Constructs a feed with nothing to feed, so pipeFeed_freeData may
+ * always be called on it
+ *
+ * @return PipeFeed empty feed
+ */
+PipeFeed pipeFeed_constructEmpty(void);
+
+/**
+ * @brief Constructs a feed of pipeFd from a new memory file, which the
+ * internal command writes its output to. The feed takes ownership of pipeFd,
+ * even upon error. Sets errno upon error.
+ *
+ * @param feed feed constructed
+ * @param pipeFd write end of the pipe to feed
+ * @return true successfully constructed feed
+ * @return false an error occurred
+ */
+bool pipeFeed_construct(PipeFeed *const feed, const int pipeFd);
+
+/**
+ * @brief Feeds what's been written to the feed's source into its pipe. The
+ * pipe is grown to fit it where possible, so an internal command feeding the
+ * pipe before the command reading it is launched needn't wait. Without
+ * block, feeds only what fits now. Output the reader of the pipe exited
+ * without reading is dropped, as a process writing it would be killed by
+ * SIGPIPE. Sets errno upon error.
+ *
+ * @param feed feed to feed
+ * @param block wait for the reader to make room for the rest of the output
+ * @return true successfully fed output, or what fits of it without block
+ * @return false an error occurred
+ */
+bool pipeFeed_feed(PipeFeed *const feed, const bool block);
+
+/**
+ * @brief Whether everything written to feed's source, as of the last feed,
+ * has been fed
+ *
+ * @param feed feed to check
+ * @return true feed is done, or empty
+ * @return false some of the output is left to feed
+ */
+bool pipeFeed_done(const PipeFeed *const feed);
+
+/**
+ * @brief Closes feed's source and pipe, which ends the output read from it.
+ * How much was fed, and how long it stalled, are kept.
+ *
+ * @param feed feed to free
+ */
+void pipeFeed_freeData(PipeFeed *const feed);
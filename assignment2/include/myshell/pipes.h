@@ -0,0 +1,86 @@
+#pragma once
+/**
+ * @file pipes.h
+ * @author Justen Di Ruscio
+ * @brief Pipes between the commands of pipelines, sized by a setting of
+ * myshell, and stats of the pipelines recently run through them to tune it
+ * with. Larger pipes let each command move more data per context switch.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <myshell/job_table.h>
+
+#define PIPES_STATS_KEPT 8 // pipelines stats are kept for, most recent first
+
+/**
+ * @brief Stats of a pipeline run as a job, once each of its processes is
+ * reaped
+ *
+ */
+typedef struct PipelineStats {
+  unsigned jobId;      // id of the pipeline's job, which may be reused since
+  char *command;       // command line of the pipeline
+  size_t pipeCapacity; // bytes each pipe between its commands held
+  size_t bytesFed;     // output of internal commands fed into its pipes
+  double feedStall;    // seconds myshell waited on full pipes to feed them
+  size_t numStages;    // number of processes of stages
+  Stage *stages;       // processes of the pipeline, in order
+} PipelineStats;
+
+/**
+ * @brief Sets the bytes each pipe is created to hold from now on, or 0 for
+ * the kernel's default. The kernel rounds sizes up to a power of 2 pages, and
+ * may not allow pipes as large, leaving them smaller.
+ *
+ * @param size bytes each pipe holds, or 0
+ */
+void pipes_setSize(const size_t size);
+
+/**
+ * @brief Bytes each pipe is created to hold, as set by pipes_setSize
+ *
+ * @return size_t bytes each pipe holds, or 0 for the kernel's default
+ */
+size_t pipes_size(void);
+
+/**
+ * @brief Creates a pipe whose ends are closed on exec, then sizes it as set
+ * by pipes_setSize. Failing to size it isn't an error, as the pipe works all
+ * the same. Sets errno upon error.
+ *
+ * @param pipeDes read then write end of the pipe created
+ * @param capacity bytes the pipe holds, as granted by the kernel
+ * @return true successfully created pipe
+ * @return false failed to create pipe
+ */
+bool pipes_create(int pipeDes[2], size_t *const capacity);
+
+/**
+ * @brief Keeps the stats of job, once each of its processes is reaped,
+ * dropping those of the least recent pipeline past PIPES_STATS_KEPT. Stats
+ * are only lost upon error.
+ *
+ * @param job finished job
+ */
+void pipes_record(const Job *const job);
+
+/**
+ * @brief Finds the stats of a recent pipeline
+ *
+ * @param age 0 for the most recent pipeline, 1 for the one before, etc.
+ * @return const PipelineStats* stats, or NULL if fewer pipelines were kept
+ */
+const PipelineStats *pipes_stats(const size_t age);
+
+/**
+ * @brief Frees the stats kept
+ *
+ */
+void pipes_freeData(void);
@@ -14,14 +14,12 @@
 
 #define ARG_DELIMETER " \n\r\t"  // delimeters separating arguments
 #define ARG_DELIMETER_LEN 4      // number of argument delimeters
-#define PIPE_DELIMETER "|"       // delimeters separating piped commands
-#define PIPE_DELIMETER_LEN 1     // number of pipe delimeters
 
 /**
  * @brief Default chars to use when stripping in readInputLine
  *
  */
-extern const String defaultStripChars;
+extern const StringView defaultStripChars;
 
 /**
  * @brief Prints the user prompt. Uses cwd as the string to store the current
@@ -38,13 +36,14 @@ void printPrompt(String *const cwd);
  * of the user's input. If EOF (Ctrl+D) is received, userInput is set to the
  * exit command. Otherwise, userInput is set to the stripped version
  * of user input line, removing any leading and lagging characters that are
- * contains in stripChars. Sets errno upon error.
+ * contains in stripChars. Strips in place, without allocating. Sets errno upon
+ * error.
  *
  * @param userInput out-parameter containing a cleaned version of the user's
  * input
- * @param stripChars String of chars to strip from userInput. A default string
- * will be used if NULL is provided
+ * @param stripChars chars to strip from userInput. Default chars will be used
+ * if NULL is provided
  * @return true Successfully read and cleaned user input.
  * @return false Error occurred; failed operations.
  */
-bool readInputLine(String *const userInput, const String *stripChars);
+bool readInputLine(String *const userInput, const StringView *stripChars);
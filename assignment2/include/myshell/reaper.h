@@ -0,0 +1,65 @@
+#pragma once
+/**
+ * @file reaper.h
+ * @author Justen Di Ruscio
+ * @brief Reaping of child processes as they change state, in the order they
+ * do so. SIGCHLD is read from a signalfd watched with epoll, so children are
+ * reaped while waiting on foreground children and while waiting for input.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+
+/**
+ * @brief Blocks SIGCHLD, to be read from a signalfd instead, and creates the
+ * epoll instances waited on. Must be called before any child is launched.
+ * Sets errno upon error.
+ *
+ * @return true successfully initialized
+ * @return false failed to initialize
+ */
+bool reaper_init(void);
+
+/**
+ * @brief Reaps every child that exited, stopped or continued, without
+ * blocking, and updates its job in the job table. Jobs are suspended once each
+ * of their processes is stopped, and removed once each is reaped; background
+ * jobs that finished and jobs that stopped are remembered for
+ * reaper_printNotifications. Sets errno upon error.
+ *
+ * @return true successfully reaped
+ * @return false failed to wait on children
+ */
+bool reaper_reap(void);
+
+/**
+ * @brief Hands the terminal to the job with jobId and blocks until it's no
+ * longer in the foreground, reaping children as they exit or stop, in any
+ * order. Takes the terminal back afterwards. Sets errno upon error.
+ *
+ * @param jobId id of the job in the foreground
+ * @return true successfully waited and managed process states
+ * @return false failed - an error occurred
+ */
+bool reaper_waitForeground(const unsigned jobId);
+
+/**
+ * @brief Blocks until stdin is readable, reaping children meanwhile. Returns
+ * immediately after reaping when stdin isn't a terminal, since input may then
+ * be buffered by stdio already. Sets errno upon error.
+ *
+ * @return true stdin is readable
+ * @return false an error occurred
+ */
+bool reaper_waitForInput(void);
+
+/**
+ * @brief Reaps children, then prints each background job that finished and
+ * each job that stopped since the last call
+ *
+ */
+void reaper_printNotifications(void);
@@ -0,0 +1,82 @@
+#pragma once
+/**
+ * @file redirect.h
+ * @author Justen Di Ruscio
+ * @brief Descriptors of a command, arranged from the pipes on either side of
+ * it and its redirections. System commands have them arranged in the child;
+ * internal commands have them arranged in myshell while they run, then
+ * restored.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <myshell/launch.h>
+#include <myshell/syntax.h>
+
+/**
+ * @brief A descriptor of myshell replaced while an internal command runs
+ *
+ */
+typedef struct SavedFd {
+  int fd;   // descriptor replaced
+  int copy; // close-on-exec copy of fd before it was replaced, or -1 if fd
+            // wasn't open
+} SavedFd;
+
+/**
+ * @brief Arranges the descriptors of command: stdinFd and stdoutFd, then its
+ * redirections in order, opening the files redirected to close-on-exec. Sets
+ * errno upon error, after reporting the file that couldn't be opened.
+ *
+ * @param command command to arrange descriptors of
+ * @param stdinFd read end of the pipe into command, or -1
+ * @param stdoutFd write end of the pipe out of command, or -1
+ * @param fds descriptors arranged, with room for 2 more than command's
+ * redirections
+ * @param numFds number of fds arranged
+ * @param opened descriptors opened, with room for each of command's
+ * redirections, or -1 for redirections not opening a file
+ * @return true successfully opened each file redirected to
+ * @return false a file couldn't be opened; those opened are closed
+ */
+bool redirect_arrange(const Command *const command, const int stdinFd,
+                      const int stdoutFd, LaunchFd *const fds,
+                      size_t *const numFds, int *const opened);
+
+/**
+ * @brief Closes the descriptors opened by redirect_arrange
+ *
+ * @param opened descriptors opened, or -1
+ * @param numOpened number of descriptors of opened
+ */
+void redirect_close(const int *const opened, const size_t numOpened);
+
+/**
+ * @brief Arranges fds in myshell itself, for an internal command, saving each
+ * descriptor replaced. stdout and stderr are flushed first, so what's buffered
+ * goes where it was written. Sets errno upon error.
+ *
+ * @param fds descriptors to arrange, in order
+ * @param numFds number of fds
+ * @param saved descriptors replaced, with room for numFds
+ * @param numSaved number of descriptors saved
+ * @return true successfully arranged fds
+ * @return false an error occurred; descriptors replaced are restored
+ */
+bool redirect_apply(const LaunchFd *const fds, const size_t numFds,
+                    SavedFd *const saved, size_t *const numSaved);
+
+/**
+ * @brief Restores the descriptors of myshell replaced by redirect_apply,
+ * after flushing stdout and stderr
+ *
+ * @param saved descriptors replaced
+ * @param numSaved number of descriptors of saved
+ */
+void redirect_restore(const SavedFd *const saved, const size_t numSaved);
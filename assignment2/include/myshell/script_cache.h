@@ -0,0 +1,40 @@
+#pragma once
+/**
+ * @file script_cache.h
+ * @author Justen Di Ruscio
+ * @brief Cache of the scripts myshell has parsed, keyed by path, so scripts
+ * run again are executed from their syntax trees without being read or
+ * parsed. A script is parsed again once its file changes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/syntax.h>
+
+/**
+ * @brief Finds the parsed script at path, reading and parsing it if it isn't
+ * cached, or if its file was replaced or modified since. The script is kept
+ * until released; a script modified while it runs, by sourcing itself for
+ * instance, is only parsed again once it's released. Sets errno upon error.
+ *
+ * @param path path of the script
+ * @return const Script* parsed script, or NULL upon error
+ */
+const Script *scriptCache_acquire(const char *const path);
+
+/**
+ * @brief Releases script, acquired by scriptCache_acquire, once it's done
+ * running
+ *
+ * @param script script to release
+ */
+void scriptCache_release(const Script *const script);
+
+/**
+ * @brief Frees every cached script. None may be acquired.
+ *
+ */
+void scriptCache_freeData(void);
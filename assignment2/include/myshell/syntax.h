@@ -0,0 +1,93 @@
+#pragma once
+/**
+ * @file syntax.h
+ * @author Justen Di Ruscio
+ * @brief Syntax tree of command lines and scripts, and the parser building it
+ * from text. A script is a sequence of pipelines separated by newlines, ';' or
+ * '&', and each pipeline is a sequence of commands separated by '|', with
+ * their arguments and redirections. Redirections are <, >, >>, <& and >&,
+ * each optionally preceded by the descriptor they redirect, like 2>&1. Words
+ * may be quoted with '' or "", or escaped with \, and '#' starts a comment.
+ * A pipeline may start with the keyword time, to report what it used.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+
+#include <jd/arena.h>
+#include <jd/string.h>
+#include <jd/vector.h>
+#include <myshell/commands/commands.h>
+
+/**
+ * @brief How a redirection opens its file
+ *
+ */
+typedef enum RedirectionKind {
+  RedirectInput,     // < path
+  RedirectOutput,    // > path, truncating it
+  RedirectAppend,    // >> path
+  RedirectDuplicate, // <& source or >& source
+  RedirectClose      // <&- or >&-
+} RedirectionKind;
+
+/**
+ * @brief A file opened onto a descriptor of a command, or another of its
+ * descriptors copied onto it
+ *
+ */
+typedef struct Redirection {
+  RedirectionKind kind;
+  int fd;      // descriptor of the command redirected
+  int source;  // descriptor copied onto fd, for RedirectDuplicate
+  String path; // file to open, for RedirectInput, Output and Append
+} Redirection;
+
+/**
+ * @brief A single command of a pipeline
+ *
+ */
+typedef struct Command {
+  enum CommandName name; // internal command, or Unknown for system commands
+  Vector args;           // String of each argument, including the command name
+  Vector redirections;   // Redirection of the command, in order
+} Command;
+
+/**
+ * @brief Commands whose outputs are piped into the next one's input, run as a
+ * single job
+ *
+ */
+typedef struct Pipeline {
+  Vector commands; // Command of each piped command, in order
+  bool background; // ended by '&'
+  bool timed;      // started by the time keyword
+  StringView text; // text the pipeline was parsed from, for job listings
+} Pipeline;
+
+/**
+ * @brief Pipelines run one after the other
+ *
+ */
+typedef struct Script {
+  Vector pipelines; // Pipeline of each pipeline, in order
+} Script;
+
+/**
+ * @brief Parses text into script. Every part of script is allocated from
+ * arena, and script refers to text, so both must outlive script. Syntax errors
+ * are reported with their line, and set errno to EINVAL. Sets errno upon
+ * error.
+ *
+ * @param text command line or script to parse
+ * @param arena arena to allocate script from
+ * @param script Script parsed
+ * @return true successfully parsed text
+ * @return false text has a syntax error, or an error occurred
+ */
+bool syntax_parse(const StringView text, Arena *const arena,
+                  Script *const script);
@@ -0,0 +1,55 @@
+#pragma once
+/**
+ * @file terminal.h
+ * @author Justen Di Ruscio
+ * @brief Control of the terminal myshell reads from, handed to the process
+ * group of the job in the foreground and taken back once it stops or exits
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+
+#include <myshell/job_table.h>
+
+/**
+ * @brief Takes control of the terminal on stdin, if it's one, waiting until
+ * myshell is in the foreground and leading its own process group. Terminal
+ * stop signals are ignored by myshell from then on. Sets errno upon error.
+ *
+ * @return true successfully took control, or stdin isn't a terminal
+ * @return false failed to take control
+ */
+bool terminal_init(void);
+
+/**
+ * @brief Descriptor of the terminal jobs are handed, for launchCommand
+ *
+ * @return int terminal file descriptor, or -1 if myshell isn't interactive
+ */
+int terminal_fd(void);
+
+/**
+ * @brief Hands the terminal to job's process group, with the terminal modes
+ * it had when it stopped. Does nothing if myshell isn't interactive. Sets
+ * errno upon error.
+ *
+ * @param job job to put in the foreground
+ * @return true successfully handed the terminal
+ * @return false failed to hand the terminal
+ */
+bool terminal_give(Job *const job);
+
+/**
+ * @brief Takes the terminal back for myshell, with its terminal modes,
+ * saving those of job if it's still around. Does nothing if myshell isn't
+ * interactive. Sets errno upon error.
+ *
+ * @param job job that held the terminal, or NULL once it's removed
+ * @return true successfully took the terminal back
+ * @return false failed to take the terminal back
+ */
+bool terminal_reclaim(Job *const job);
@@ -0,0 +1,83 @@
+#pragma once
+/**
+ * @file timing.h
+ * @author Justen Di Ruscio
+ * @brief Timing of pipelines, started by the time keyword or every pipeline
+ * once set to. Each process of a timed job is reported once the job finishes,
+ * from the resources wait4 returned as it was reaped, so the slow stage of a
+ * pipeline stands out. Pipelines of internal commands alone are reported from
+ * what myshell and the children it reaped used while they ran.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include <myshell/job_table.h>
+
+/**
+ * @brief Resources used by myshell and its reaped children at some point, to
+ * report what was used since
+ *
+ */
+typedef struct TimingMark {
+  struct timespec start;  // monotonic time of the mark
+  struct rusage self;     // used by myshell
+  struct rusage children; // used by the children myshell reaped
+} TimingMark;
+
+/**
+ * @brief Sets whether every pipeline is timed, as if started by time
+ *
+ * @param always whether to time every pipeline
+ */
+void timing_setAlways(const bool always);
+
+/**
+ * @brief Whether every pipeline is timed, as set by timing_setAlways
+ *
+ * @return true every pipeline is timed
+ * @return false only pipelines started by time are timed
+ */
+bool timing_always(void);
+
+/**
+ * @brief Formats the report of job, once each of its processes is reaped: the
+ * wall time, user and system CPU time, peak memory and voluntary and
+ * involuntary context switches of each process, then of the whole pipeline.
+ * Sets errno upon error.
+ *
+ * @param job finished job
+ * @return char* report, to be freed by the caller, or NULL upon error
+ */
+char *timing_report(const Job *const job);
+
+/**
+ * @brief Marks the resources used by myshell and its reaped children so far.
+ * Sets errno upon error.
+ *
+ * @param mark TimingMark marked
+ * @return true successfully marked resources
+ * @return false failed to read resources
+ */
+bool timing_mark(TimingMark *const mark);
+
+/**
+ * @brief Prints what myshell and the children it reaped used since mark, for
+ * command. Peak memory isn't per mark; it's the peak so far. Sets errno upon
+ * error.
+ *
+ * @param mark TimingMark marked before running command
+ * @param command command line run since mark
+ * @param stream stream to print to
+ * @return true successfully printed report
+ * @return false failed to read resources
+ */
+bool timing_printSince(const TimingMark *const mark, const StringView command,
+                       FILE *const stream);
@@ -0,0 +1,208 @@
+/**
+ * @file command_hash.c
+ * @author Justen Di Ruscio
+ * @brief Cache of the paths system commands were found at in PATH, so each
+ * launch execs the command directly rather than trying every PATH directory.
+ * Like bash's command hash, it's emptied whenever PATH changes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <myshell/command_hash.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <jd/hashmap.h>
+
+/**
+ * @brief Where a command was found. path is a single allocation holding the
+ * path, then the command name the entry's key points to.
+ *
+ */
+typedef struct CommandHashEntry {
+  char *path;
+  unsigned hits; // times found in the cache rather than PATH
+} CommandHashEntry;
+
+HASHMAP_DECLARE_TYPED(CommandHash, commandHash, const char *, CommandHashEntry,
+                      hashMap_hashCString, hashMap_equalsCString)
+
+// constructed along with hashedPath, on first use
+static CommandHash commands;
+
+// PATH the cached commands were found in, or NULL before any were
+static char *hashedPath = (char *)NULL;
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief The path searched without PATH set, as execvp and posix_spawnp do:
+ * the system's from confstr, or else /bin:/usr/bin
+ *
+ */
+static const char *defaultPath() {
+  static char systemPath[256] = "";
+  if (systemPath[0] == '\0') {
+    const size_t length = confstr(_CS_PATH, systemPath, sizeof(systemPath));
+    if (length == 0 || length > sizeof(systemPath)) {
+      strcpy(systemPath, "/bin:/usr/bin");
+    }
+  }
+  return systemPath;
+}
+
+/**
+ * @brief Empties the cache if PATH changed since commands were cached in it.
+ * Without PATH set, the default path is searched. Sets errno upon error.
+ *
+ * @return true cache matches PATH
+ * @return false failed to record PATH
+ */
+static bool syncWithPath() {
+  const char *const path = getenv("PATH");
+  const char *const current = path != (char *)NULL ? path : defaultPath();
+  if (hashedPath == (char *)NULL) {
+    commands = commandHash_constructEmpty();
+  } else if (strcmp(hashedPath, current) == 0) {
+    return true;
+  }
+  commandHash_clear();
+  free(hashedPath);
+  hashedPath = strdup(current);
+  return hashedPath != (char *)NULL; // errno set by strdup
+}
+
+/**
+ * @brief Searches each directory of PATH for an executable regular file
+ * named name, the way execvp does. Sets errno upon error.
+ *
+ * @param name command name
+ * @return char* allocation holding the found path then name, or NULL
+ */
+static char *searchPath(const char *const name) {
+  const size_t nameLength = strlen(name);
+  const char *dir = hashedPath;
+  while (true) {
+    // Empty directories of PATH mean the current directory
+    const char *dirEnd = strchr(dir, ':');
+    if (dirEnd == (char *)NULL) {
+      dirEnd = dir + strlen(dir);
+    }
+    const size_t dirLength = dirEnd != dir ? (size_t)(dirEnd - dir) : 1;
+    const char *const dirName = dirEnd != dir ? dir : ".";
+
+    // dir/name, then name again for the cache's key
+    const size_t pathSize = dirLength + 1 + nameLength + 1;
+    char *const found = malloc(pathSize + nameLength + 1);
+    if (found == (char *)NULL) {
+      return found; // errno set by malloc
+    }
+    memcpy(found, dirName, dirLength);
+    found[dirLength] = '/';
+    memcpy(found + dirLength + 1, name, nameLength + 1);
+
+    struct stat info;
+    if (stat(found, &info) == 0 && S_ISREG(info.st_mode) &&
+        access(found, X_OK) == 0) {
+      memcpy(found + pathSize, name, nameLength + 1);
+      return found;
+    }
+    free(found);
+
+    if (*dirEnd == '\0') {
+      errno = ENOENT;
+      return (char *)NULL;
+    }
+    dir = dirEnd + 1;
+  }
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+const char *commandHash_resolve(const char *const name) {
+  const char fooName[] = "commandHash_resolve";
+
+  // Argument Validity Check
+  errno = 0;
+  if (name == (char *)NULL) {
+    fprintf(stderr, "argument 'name' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return (char *)NULL;
+  }
+
+  // Paths aren't searched for
+  if (strchr(name, '/') != (char *)NULL) {
+    return name;
+  }
+  if (!syncWithPath()) {
+    fprintf(stderr, "Failure recording PATH in %s\n", fooName);
+    return (char *)NULL;
+  }
+
+  // Found in cache
+  CommandHashEntry *const cached = commandHash_find(&commands, name);
+  if (cached != (CommandHashEntry *)NULL) {
+    ++cached->hits;
+    return cached->path;
+  }
+
+  // Otherwise search PATH and cache where name was found
+  char *const found = searchPath(name);
+  if (found == (char *)NULL) {
+    return found; // errno set by searchPath
+  }
+  const char *const key = found + strlen(found) + 1;
+  const CommandHashEntry entry = {.path = found, .hits = 0};
+  if (!commandHash_insert(&commands, key, entry)) {
+    free(found);
+    return (char *)NULL; // errno set by commandHash_insert
+  }
+  return found;
+}
+
+void commandHash_forget(const char *const name) {
+  if (name == (char *)NULL || hashedPath == (char *)NULL) {
+    return;
+  }
+  CommandHashEntry *const cached = commandHash_find(&commands, name);
+  if (cached == (CommandHashEntry *)NULL) {
+    return;
+  }
+  char *const path = cached->path; // also holds the key
+  commandHash_erase(&commands, name);
+  free(path);
+}
+
+void commandHash_clear(void) {
+  if (hashedPath == (char *)NULL) {
+    return; // nothing cached yet
+  }
+  const HashMap *const map = &commands.map;
+  for (size_t slot = hashMap_nextSlot(map, 0); slot < map->capacity;
+       slot = hashMap_nextSlot(map, slot + 1)) {
+    free(((CommandHashEntry *)hashMap_valueAt(map, slot))->path);
+  }
+  hashMap_clear(&commands.map);
+}
+
+bool commandHash_print(FILE *const stream) {
+  const HashMap *const map = &commands.map;
+  if (hashedPath == (char *)NULL || map->length == 0) {
+    return false;
+  }
+  fprintf(stream, "hits\tcommand\n");
+  for (size_t slot = hashMap_nextSlot(map, 0); slot < map->capacity;
+       slot = hashMap_nextSlot(map, slot + 1)) {
+    const CommandHashEntry *const entry = hashMap_valueAt(map, slot);
+    fprintf(stream, "%4u\t%s\n", entry->hits, entry->path);
+  }
+  return true;
+}
@@ -13,44 +13,101 @@
 #include <myshell/commands/commands.h>
 
 #include <stdio.h>
-#include <unistd.h>
+#include <string.h>
 
 #include <myshell/commands/internal/bg.h>
 #include <myshell/commands/internal/cd.h>
 #include <myshell/commands/internal/exit.h>
 #include <myshell/commands/internal/fg.h>
+#include <myshell/commands/internal/hash.h>
+#include <myshell/commands/internal/history.h>
+#include <myshell/commands/internal/jobs.h>
+#include <myshell/commands/internal/pipes.h>
+#include <myshell/commands/internal/source.h>
+#include <myshell/commands/internal/time.h>
+#include <myshell/command_hash.h>
 
-const char *availableCommandNames[] = {CD_COMMAND_NAME, EXIT_COMMAND_NAME,
-                                       FG_COMMAND_NAME, BG_COMMAND_NAME};
-const unsigned numAvailableCommands =
-    sizeof(availableCommandNames) / sizeof(*availableCommandNames);
+/**
+ * @brief An internal command, with the function executing it
+ *
+ */
+typedef struct Builtin {
+  const char *name; // command name as a string expected on the command line
+  size_t nameLength;
+  int (*execute)(const char *, const Vector *);
+} Builtin;
+
+#define BUILTIN_ENTRY(name, first, text, executor)                            \
+  [name] = {text, sizeof(text) - 1, executor},
+
+/**
+ * @brief Every internal command, at the index of its CommandName
+ *
+ */
+static const Builtin builtins[] = {BUILTIN_COMMANDS(BUILTIN_ENTRY)};
+
+// Slots of the perfect hash of builtin names; a power of two
+#define BUILTIN_SLOTS 32u
 
 /**
- * @brief Array of function pointers to functions handling each system command.
+ * @brief Perfect hash of a builtin name from its first character and length,
+ * a constant expression given constants
  *
  */
-int (*commandExecutors[])(const char *, const Vector *) = {
-    executeCd, executeExit, executeFg, executeBg};
+#define BUILTIN_SLOT(first, length)                                           \
+  (((unsigned)(unsigned char)(first) + (unsigned)(length)) &                  \
+   (BUILTIN_SLOTS - 1))
+
+#define BUILTIN_SLOT_ENTRY(name, first, text, executor)                       \
+  [BUILTIN_SLOT(first, sizeof(text) - 1)] = name,
+
+/**
+ * @brief CommandName of the builtin at each slot of the perfect hash, or
+ * Unknown. Two builtins sharing a slot fail to compile, and call for another
+ * hash.
+ *
+ */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Woverride-init"
+static const enum CommandName builtinSlots[BUILTIN_SLOTS] = {
+    BUILTIN_COMMANDS(BUILTIN_SLOT_ENTRY)};
+#pragma GCC diagnostic pop
+
+// A name's first character isn't a constant expression, so the one hashed is
+// checked against it in a constant initializer instead: a mismatch divides
+// by zero, which fails to compile
+#define BUILTIN_FIRST_CHECK(name, first, text, executor)                      \
+  1 / ((text)[0] == (first)),
+static const char builtinFirstsMatch[]
+    __attribute__((unused)) = {BUILTIN_COMMANDS(BUILTIN_FIRST_CHECK)};
 
 enum CommandName parseCommandName(const String *const commandName) {
   const char fooName[] = "parseCommandName";
   errno = 0;
 
   // Argument Validity Check
-  if (commandName == (String *)NULL || commandName->data == (char *)NULL) {
+  if (commandName == (String *)NULL) {
     fprintf(stderr, "field 'commandName' of %s must point to a valid string\n",
             fooName);
     errno = EPERM;
     return Unknown;
   }
 
-  // Parse Name
-  for (unsigned cmdIdx = 1; cmdIdx <= numAvailableCommands; ++cmdIdx) {
-    if (!string_compareChar(commandName, availableCommandNames[cmdIdx - 1])) {
-      return (enum CommandName)(cmdIdx);
-    }
+  // Parse Name: the only builtin it could be is at its slot, so at most one
+  // comparison is made
+  if (commandName->length == 0) {
+    return Unknown;
   }
-  return Unknown;
+  const char first = string_constData(commandName)[0];
+  const enum CommandName name =
+      builtinSlots[BUILTIN_SLOT(first, commandName->length)];
+  const Builtin *const builtin = &builtins[name];
+  if (name == Unknown || builtin->nameLength != commandName->length ||
+      memcmp(builtin->name, string_constData(commandName),
+             commandName->length) != 0) {
+    return Unknown;
+  }
+  return name;
 }
 
 int execInternal(const enum CommandName name, const Vector *const commandArgs) {
@@ -72,25 +129,22 @@ int execInternal(const enum CommandName name, const Vector *const commandArgs) {
   }
 
   // Execute Internal Command
-  // command name as string for error reporting
-  const char *const commandName = availableCommandNames[name - 1];
-  // executor for selected command
-  int (*commandExecutor)(const char *, const Vector *);
-  commandExecutor = commandExecutors[name - 1];
-  // run selected command through executor
-  return commandExecutor(commandName, commandArgs);
+  // run selected command through its executor, with its name as a string for
+  // error reporting
+  const Builtin *const builtin = &builtins[name];
+  return builtin->execute(builtin->name, commandArgs);
 }
 
-int execSystem(const Vector *const cmdArgs) {
+pid_t execSystem(const Vector *const cmdArgs, const LaunchIo *const io) {
   const char fooName[] = "execSystem";
 
   // Argument Validity Check
   errno = 0;
-  if (cmdArgs == (Vector *)NULL) {
-    fprintf(stderr, "argument 'cmdArgs' of %s must point to a valid addrss\n",
+  if (cmdArgs == (Vector *)NULL || cmdArgs->length == 0) {
+    fprintf(stderr, "argument 'cmdArgs' of %s must hold a command name\n",
             fooName);
     errno = EPERM;
-    return errno;
+    return -1;
   }
 
   // Exec system command
@@ -98,10 +152,24 @@ int execSystem(const Vector *const cmdArgs) {
   char *argv[cmdArgs->length + 1];
   argv[cmdArgs->length] = (char *)NULL;
   for (size_t cmdIdx = 0; cmdIdx < cmdArgs->length; ++cmdIdx) {
-    const String *const arg = (String *)vector_at(cmdArgs, cmdIdx);
-    argv[cmdIdx] = arg->data;
+    String *const arg = (String *)vector_atUnchecked(cmdArgs, cmdIdx);
+    argv[cmdIdx] = string_data(arg);
+  }
+  // exec the path cached for argv[0], forgetting it if it's gone and
+  // searching PATH once more
+  const char *path = commandHash_resolve(argv[0]);
+  if (path == (char *)NULL) {
+    return -1; // errno set by commandHash_resolve
+  }
+  // launch without copying myshell's page tables where possible
+  pid_t pid = launchCommand(path, argv, io, LaunchSpawn);
+  if (pid == -1 && errno == ENOENT && path != argv[0]) {
+    commandHash_forget(argv[0]);
+    path = commandHash_resolve(argv[0]);
+    if (path == (char *)NULL) {
+      return -1; // errno set by commandHash_resolve
+    }
+    pid = launchCommand(path, argv, io, LaunchSpawn);
   }
-  // system call
-  execvp(argv[0], argv);
-  return errno;
+  return pid;
 }
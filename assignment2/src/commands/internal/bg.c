@@ -19,45 +19,41 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/types.h>
-#include <sys/wait.h>
 #include <unistd.h>
 
 #include "argument_validity.h"
 #include <jd/error.h>
 #include <jd/string.h>
 #include <jd/vector.h>
-#include <myshell/job_states.h>
+#include <myshell/job_table.h>
 
 static char *helpMessage() {
   return "bg - send jobs to background; resuming them if they are suspended\n"
-         "If no job PID is specified, all foreground processes are sent to\n"
-         "background\n"
-         "bg [PID...]\n";
+         "If no job is specified, all suspended jobs are sent to background.\n"
+         "Jobs are given by %ID, or by the PID of any of their processes\n"
+         "bg [JOB...]\n";
 }
 
 /**
- * @brief Sends process with PID pid to background. Sets errno upon error.
+ * @brief Sends job to background, resuming it. Sets errno upon error.
  *
- * @param pid process ID to background
+ * @param job job to background
  * @return int errno
  */
-static int bgChild(const pid_t pid) {
-  const char fooName[] = "bgChild";
+static int bgJob(Job *const job) {
+  const char fooName[] = "bgJob";
 
-  // Add child PID to list of background jobs
-  const bool pushed = vector_pushBack(&bgPids, &pid);
-  if (!pushed) {
-    fprintf(stderr, "Failed to add pid %i to list of background jobs in %s\n",
-            pid, fooName);
-    return errno;
-  }
+  // Move job to background
+  jobTable_setState(job, JobBackground);
+  printf("[%u] %s &\n", job->id, job->command);
 
-  // Send signal to job with specified PID
-  const bool sent = !kill(pid, SIGCONT);
+  // Send signal to every process of job
+  const bool sent = jobTable_signal(job, SIGCONT);
   if (!sent) {
     fprintf(stderr,
-            "Failed to send SIGCONT (%i) signal to child with PID %i in %s\n",
-            SIGCONT, pid, fooName);
+            "Failed to send SIGCONT (%i) signal to job %u with process group "
+            "%i in %s\n",
+            SIGCONT, job->id, job->pgid, fooName);
     return errno;
   }
 
@@ -66,68 +62,51 @@ static int bgChild(const pid_t pid) {
 
 int executeBg(const char *const commandName, const Vector *const commandArgs) {
   const char fooName[] = "executeBg";
-  Vector childPids = vector_constructEmpty(sizeof(pid_t));
   int err = argumentValidityCheck(commandName, commandArgs, fooName);
   if (err != 0) {
     return err; // errno set by argumentValidityCheck
   }
 
-  // Parse provided arguments for job PID
-  // provided PID arguments -> parse PIDs
+  // Parse provided arguments for jobs
+  // provided job arguments -> check each is suspended before resuming any
   if (commandArgs->length >= 2) {
-    for (unsigned pidIdx = 1; pidIdx < commandArgs->length; ++pidIdx) {
-      // convert PID arg to int
-      const String *pidStr = (String *)vector_at(commandArgs, pidIdx);
-      const int pid = strtol(pidStr->data, NULL, 10);
-      if (errno != 0) {
-        fprintf(stderr, "Failure converting provided PID %s to integer in %s\n",
-                pidStr->data, fooName);
-        return errno; // errno set by strtol
-      }
-      // find PID arg in suspended PIDs
-      ssize_t suspendedIdx = vector_find(&suspendedPids, &pid);
-      if (suspendedIdx == -1) {
-        fprintf(stderr, "PID %i is not a suspended subprocess in %s\n", pid,
-                fooName);
+    for (unsigned jobIdx = 1; jobIdx < commandArgs->length; ++jobIdx) {
+      const String *jobStr = (String *)vector_at(commandArgs, jobIdx);
+      const Job *const job = jobTable_findSpec(string_constData(jobStr));
+      if (job == (Job *)NULL || job->state != JobSuspended) {
+        fprintf(stderr, "%s is not a suspended job in %s\n",
+                string_constData(jobStr), fooName);
         return ENOENT;
       }
-      // add PID arg to processes to background
-      const bool pushed = vector_pushBack(&childPids, &pid);
-      if (!pushed) {
-        fprintf(stderr,
-                "Failure adding pid %i to list of pids to background in %s\n",
-                pid, fooName);
-        vector_freeData(&childPids);
-        return errno; // errno set by vector_pushBack
-      }
-      // remove PID from list of suspended PIDs
-      const bool erased = vector_erase(&suspendedPids, suspendedIdx);
-      if (!erased) {
-        fprintf(stderr,
-                "Failure erasing PID %i  from list of suspended PIDs in %s\n",
-                pid, fooName);
-        return errno;
+    }
+    for (unsigned jobIdx = 1; jobIdx < commandArgs->length; ++jobIdx) {
+      const String *jobStr = (String *)vector_at(commandArgs, jobIdx);
+      Job *const job = jobTable_findSpec(string_constData(jobStr));
+      err = job->state == JobSuspended ? bgJob(job) : 0; // given twice
+      if (err != 0) {
+        fprintf(stderr, "Failure trying to send job %u to background in %s\n",
+                job->id, fooName);
+        return err;
       }
     }
   }
 
-  // provided no specific PID argument -> send to all children
+  // provided no specific job argument -> send all suspended jobs
   else if (commandArgs->length == 1) {
     // no jobs to background
-    if (suspendedPids.length == 0) {
+    if (jobTable_count(JobSuspended) == 0) {
       fprintf(stderr, "bg: No suitable jobs\n");
       return 0;
     }
-    // copy all suspended PIDs to background
-    OptionalVector optVec = vector_copyConstruct(&suspendedPids);
-    if (!optVec.valid) {
-      fprintf(stderr, "Failure to copy construct child PIDs in %s", fooName);
-      vector_freeData(&optVec.data);
-      return errno; // errno set by vector_copyConstruct
+    for (Job *job = jobTable_next(1); job != (Job *)NULL;
+         job = jobTable_next(job->id + 1)) {
+      err = job->state == JobSuspended ? bgJob(job) : 0;
+      if (err != 0) {
+        fprintf(stderr, "Failure trying to send job %u to background in %s\n",
+                job->id, fooName);
+        return err;
+      }
     }
-    childPids = optVec.data;
-    // remove PIDs to background from list of suspended PIDs
-    vector_clear(&suspendedPids);
   }
 
   // provided incorrect number of arguments
@@ -138,19 +117,5 @@ int executeBg(const char *const commandName, const Vector *const commandArgs) {
     return errno;
   }
 
-  // Background children
-  for (unsigned pidIdx = 0; pidIdx < childPids.length; ++pidIdx) {
-    const pid_t *pid = (pid_t *)vector_at(&childPids, pidIdx);
-    const int err = bgChild(*pid);
-    if (err != 0) {
-      fprintf(stderr,
-              "Failure trying to bring child with PID %i to foreground in %s\n",
-              *pid, fooName);
-      vector_freeData(&childPids);
-      return errno;
-    }
-  }
-
-  vector_freeData(&childPids);
   return errno;
 }
@@ -40,7 +40,7 @@ int executeCd(const char *const commandName, const Vector *const commandArgs) {
               commandName, fooName);
       return errno; // errno set by vector_at
     }
-    chdir(path->data);
+    chdir(string_constData(path));
   } else {
     fprintf(stderr,
             "%s called with %zu positional arguments but expects 1\n%s\n",
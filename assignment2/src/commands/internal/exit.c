@@ -20,7 +20,7 @@
 #include "argument_validity.h"
 #include <jd/error.h>
 #include <jd/string.h>
-#include <myshell/job_states.h>
+#include <myshell/job_table.h>
 
 static char *helpMessage() {
   return "exit - exit program"
@@ -47,7 +47,7 @@ int executeExit(const char *const commandName,
               fooName);
       return errno; // errno set by vector_at
     }
-    statusCode = strtol(statusString->data, NULL, 10);
+    statusCode = strtol(string_constData(statusString), NULL, 10);
     if (errno != 0) {
       fprintf(stderr,
               "Failure converting provided exit status to integer in %s\n",
@@ -61,14 +61,14 @@ int executeExit(const char *const commandName,
     return EPERM;
   }
 
-  // Kill all child processes in background or suspended
-  for (unsigned i = 0; i < bgPids.length; ++i) {
-    const pid_t *pid = (pid_t *)vector_at(&bgPids, i);
-    kill(*pid, SIGINT);
-  }
-  for (unsigned i = 0; i < suspendedPids.length; ++i) {
-    const pid_t *pid = (pid_t *)vector_at(&suspendedPids, i);
-    kill(*pid, SIGINT);
+  // Kill all jobs in background or suspended, continuing suspended ones to
+  // receive it
+  for (const Job *job = jobTable_next(1); job != (Job *)NULL;
+       job = jobTable_next(job->id + 1)) {
+    jobTable_signal(job, SIGINT);
+    if (job->state == JobSuspended) {
+      jobTable_signal(job, SIGCONT);
+    }
   }
 
   // Exit program
@@ -19,45 +19,44 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/types.h>
-#include <sys/wait.h>
 #include <unistd.h>
 
 #include "argument_validity.h"
 #include <jd/error.h>
 #include <jd/string.h>
 #include <jd/vector.h>
-#include <myshell/job_states.h>
+#include <myshell/job_table.h>
+#include <myshell/reaper.h>
 
 static char *helpMessage() {
   return "fg - bring job to foreground\n"
-         "If no job PID is specified, all child process are brought to\n"
-         "foreground\n"
-         "fg [PID]\n";
+         "If no job is specified, the current job is brought to foreground.\n"
+         "Jobs are given by %ID, or by the PID of any of their processes\n"
+         "fg [JOB]\n";
 }
 
 /**
- * @brief Sends process with PID pid to foreground. Sets errno upon error.
+ * @brief Sends job to foreground, resuming it if it's suspended. Sets errno
+ * upon error.
  *
- * @param pid process ID to foreground
+ * @param job job to foreground
  * @return int errno
  */
-static int fgChild(const pid_t pid) {
-  const char fooName[] = "fgChild";
-
-  // Add child PID to list of foreground jobs
-  const bool pushed = vector_pushBack(&fgPids, &pid);
-  if (!pushed) {
-    fprintf(stderr, "Failed to add pid %i to list of foreground jobs in %s\n",
-            pid, fooName);
-    return errno;
-  }
+static int fgJob(Job *const job) {
+  const char fooName[] = "fgJob";
+
+  // Move job to foreground
+  printf("%s\n", job->command);
+  fflush(stdout);
+  jobTable_setState(job, JobForeground);
 
-  // Send signal to job with specified PID
-  const bool sent = !kill(pid, SIGCONT);
+  // Send signal to every process of job
+  const bool sent = jobTable_signal(job, SIGCONT);
   if (!sent) {
     fprintf(stderr,
-            "Failed to send SIGCONT (%i) signal to child with PID %i in %s\n",
-            SIGCONT, pid, fooName);
+            "Failed to send SIGCONT (%i) signal to job %u with process group "
+            "%i in %s\n",
+            SIGCONT, job->id, job->pgid, fooName);
     return errno;
   }
 
@@ -66,81 +65,31 @@ static int fgChild(const pid_t pid) {
 
 int executeFg(const char *const commandName, const Vector *const commandArgs) {
   const char fooName[] = "executeFg";
-  Vector childPids = vector_constructEmpty(sizeof(pid_t));
   int err = argumentValidityCheck(commandName, commandArgs, fooName);
   if (err != 0) {
     return err; // errno set by argumentValidityCheck
   }
 
-  // Parse provided arguments for job PID
-  // provided single PID argument -> parse single PID
+  // Parse provided arguments for job
+  Job *job = (Job *)NULL;
+  // provided single job argument -> find job
   if (commandArgs->length == 2) {
-    // convert arg to int
-    const String *pidStr = (String *)vector_at(commandArgs, 1);
-    const int pid = strtol(pidStr->data, NULL, 10);
-    if (errno != 0) {
-      fprintf(stderr, "Failure converting provided PID %s to integer in %s\n",
-              pidStr->data, fooName);
-      return errno; // errno set by strtol
-    }
-    // find PID arg in suspended or bg PIDs
-    ssize_t suspendedIdx = vector_find(&suspendedPids, &pid);
-    ssize_t bgIdx = vector_find(&bgPids, &pid);
-    if (suspendedIdx == -1 && bgIdx == -1) {
-      fprintf(stderr, "PID %i is not a suspended or background subprocess\n",
-              pid);
+    const String *jobStr = (String *)vector_at(commandArgs, 1);
+    job = jobTable_findSpec(string_constData(jobStr));
+    if (job == (Job *)NULL || job->state == JobForeground) {
+      fprintf(stderr, "%s is not a suspended or background job\n",
+              string_constData(jobStr));
       return ENOENT;
     }
-    // add PID arg processes to foreground
-    const bool pushed = vector_pushBack(&childPids, &pid);
-    if (!pushed) {
-      fprintf(stderr,
-              "Failure adding pid %i to list of pids to foreground in %s\n",
-              pid, fooName);
-      vector_freeData(&childPids);
-      return errno; // errno set by vector_pushBack
-    }
-
-    // remove PID from suspended/bg lists
-    bool erased;
-    if (suspendedIdx == -1) {
-      erased = vector_erase(&bgPids, bgIdx);
-      if (!erased) {
-        fprintf(
-            stderr,
-            "failed to erase %zu element in list of background PIDs in %s\n",
-            bgIdx, fooName);
-        return errno; // errno set by vector_erase
-      }
-    } else {
-      erased = vector_erase(&suspendedPids, suspendedIdx);
-      if (!erased) {
-        fprintf(stderr,
-                "failed to erase %zu element in list of suspended PIDs in %s\n",
-                suspendedIdx, fooName);
-        return errno; // errno set by vector_erase
-      }
-    }
   }
 
-  // provided no specific PID argument -> send to all children
+  // provided no specific job argument -> current job
   else if (commandArgs->length == 1) {
-    // no jobs to foreground
-    if (suspendedPids.length == 0 && bgPids.length == 0) {
+    job = jobTable_current();
+    if (job == (Job *)NULL) {
       fprintf(stderr, "fg: No such job\n");
       return 0;
     }
-    // assign all suspended and background PIDS child PIDS to foreground
-    OptionalVector optVec = vector_append(&suspendedPids, &bgPids);
-    if (!optVec.valid) {
-      fprintf(stderr, "Failure to append suspended and background PIDs in %s",
-              fooName);
-      vector_freeData(&optVec.data);
-      return errno; // errno set by vector_append
-    }
-    childPids = optVec.data;
-    vector_clear(&suspendedPids);
-    vector_clear(&bgPids);
   }
 
   // provided incorrect number of arguments
@@ -151,27 +100,22 @@ int executeFg(const char *const commandName, const Vector *const commandArgs) {
     return errno;
   }
 
-  // Foreground children
-  for (unsigned pidIdx = 0; pidIdx < childPids.length; ++pidIdx) {
-    const pid_t *pid = (pid_t *)vector_at(&childPids, pidIdx);
-    const int err = fgChild(*pid);
-    if (err != 0) {
-      fprintf(stderr,
-              "Failure trying to bring child with PID %i to foreground in %s\n",
-              *pid, fooName);
-      vector_freeData(&childPids);
-      return errno;
-    }
+  // Foreground job
+  const unsigned jobId = job->id;
+  err = fgJob(job);
+  if (err != 0) {
+    fprintf(stderr, "Failure trying to bring job %u to foreground in %s\n",
+            jobId, fooName);
+    return err;
   }
 
-  // Wait for all foregrounded children
-  const bool waited = waitForForegroundPids();
+  // Wait for foregrounded job
+  const bool waited = reaper_waitForeground(jobId);
   if (!waited) {
-    fprintf(stderr, "Parent %i failed to wait for children in %s\n", getpid(),
-            fooName);
-    return errno; // errno set by waitForForegroundPids
+    fprintf(stderr, "Parent %i failed to wait for job %u in %s\n", getpid(),
+            jobId, fooName);
+    return errno; // errno set by reaper_waitForeground
   }
 
-  vector_freeData(&childPids);
   return errno;
 }
@@ -0,0 +1,69 @@
+/**
+ * @file hash.c
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to inspect and
+ * clear the cache of system command paths.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/commands/internal/hash.h>
+
+#include <stdio.h>
+
+#include "argument_validity.h"
+#include <jd/error.h>
+#include <jd/string.h>
+#include <myshell/command_hash.h>
+
+static char *helpMessage() {
+  return "hash - remember where commands were found in PATH\n"
+         "Lists remembered commands, forgets all of them with -r, or finds\n"
+         "and remembers each NAME\n"
+         "hash [-r] [NAME...]\n";
+}
+
+int executeHash(const char *const commandName,
+                const Vector *const commandArgs) {
+  const char fooName[] = "executeHash";
+  const int err = argumentValidityCheck(commandName, commandArgs, fooName);
+  if (err != 0) {
+    return err;
+  }
+
+  // List remembered commands
+  if (commandArgs->length == 1) {
+    if (!commandHash_print(stdout)) {
+      printf("%s: hash table empty\n", commandName);
+    }
+    return errno;
+  }
+
+  // Forget every command, then remember each NAME
+  size_t argIdx = 1;
+  const String *const first = (String *)vector_atUnchecked(commandArgs, 1);
+  if (!string_compareChar(first, "-r")) {
+    commandHash_clear();
+    ++argIdx;
+  } else if (string_constData(first)[0] == '-') {
+    fprintf(stderr, "%s: invalid option %s\n%s\n", commandName,
+            string_constData(first), helpMessage());
+    errno = EINVAL;
+    return errno;
+  }
+  int result = 0;
+  for (; argIdx < commandArgs->length; ++argIdx) {
+    const String *const name =
+        (String *)vector_atUnchecked(commandArgs, argIdx);
+    if (commandHash_resolve(string_constData(name)) == (char *)NULL) {
+      fprintf(stderr, "%s: %s: not found\n", commandName,
+              string_constData(name));
+      result = errno; // errno set by commandHash_resolve
+    }
+  }
+  errno = result;
+  return errno;
+}
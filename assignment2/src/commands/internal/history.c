@@ -0,0 +1,85 @@
+/**
+ * @file history.c
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to list and
+ * search the history of command lines.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/commands/internal/history.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "argument_validity.h"
+#include <jd/error.h>
+#include <jd/string.h>
+#include <myshell/history.h>
+
+static char *helpMessage() {
+  return "history - list or search the history of command lines\n"
+         "Lists every entry, or the last N, by number. With -s, lists the\n"
+         "entries holding TEXT, most recent first, as reverse search does.\n"
+         "Entries are run again with !N, !-N, !! or !PREFIX\n"
+         "history [N]\n"
+         "history -s TEXT\n";
+}
+
+/**
+ * @brief Prints entry number of history
+ *
+ */
+static void printEntry(const size_t number) {
+  const StringView entry = history_entry(number);
+  printf("%5zu  %.*s\n", number, (int)entry.length, entry.data);
+}
+
+int executeHistory(const char *const commandName,
+                   const Vector *const commandArgs) {
+  const char fooName[] = "executeHistory";
+  const int err = argumentValidityCheck(commandName, commandArgs, fooName);
+  if (err != 0) {
+    return err;
+  }
+  const size_t count = history_count();
+
+  // List every entry
+  if (commandArgs->length == 1) {
+    for (size_t number = 1; number <= count; ++number) {
+      printEntry(number);
+    }
+    return errno;
+  }
+
+  // List entries holding TEXT, most recent first
+  const String *const first = (String *)vector_atUnchecked(commandArgs, 1);
+  if (commandArgs->length == 3 && !string_compareChar(first, "-s")) {
+    const StringView text =
+        string_view((String *)vector_atUnchecked(commandArgs, 2));
+    for (size_t number = history_search(text, count + 1); number != 0;
+         number = history_search(text, number)) {
+      printEntry(number);
+    }
+    return errno;
+  }
+
+  // List the last N entries
+  char *end;
+  const unsigned long last = strtoul(string_constData(first), &end, 10);
+  if (commandArgs->length != 2 || *end != '\0' ||
+      string_constData(first)[0] == '-') {
+    fprintf(stderr, "Incorrect arguments provided to %s in %s\n%s\n",
+            HISTORY_COMMAND_NAME, fooName, helpMessage());
+    errno = EINVAL;
+    return errno;
+  }
+  for (size_t number = last < count ? count - last + 1 : 1; number <= count;
+       ++number) {
+    printEntry(number);
+  }
+  return errno;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file jobs.c
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to list jobs.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/commands/internal/jobs.h>
+
+#include <stdio.h>
+
+#include "argument_validity.h"
+#include <jd/error.h>
+#include <myshell/job_table.h>
+
+static char *helpMessage() {
+  return "jobs - list jobs\n"
+         "Lists each job with its id, process group, state and command\n"
+         "jobs\n";
+}
+
+int executeJobs(const char *const commandName,
+                const Vector *const commandArgs) {
+  const char fooName[] = "executeJobs";
+  const int err = argumentValidityCheck(commandName, commandArgs, fooName);
+  if (err != 0) {
+    return err;
+  }
+  if (commandArgs->length != 1) {
+    fprintf(stderr, "Too many arguments provided to %s in %s\n%s\n",
+            JOBS_COMMAND_NAME, fooName, helpMessage());
+    errno = EPERM;
+    return errno;
+  }
+
+  // List jobs in order of id, marking the current job with +
+  const Job *const current = jobTable_current();
+  for (const Job *job = jobTable_next(1); job != (Job *)NULL;
+       job = jobTable_next(job->id + 1)) {
+    printf("[%u]%c %-8i %-8s %s\n", job->id, job == current ? '+' : ' ',
+           job->pgid, job->state == JobSuspended ? "Stopped" : "Running",
+           job->command);
+  }
+  return errno;
+}
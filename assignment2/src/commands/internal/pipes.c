@@ -0,0 +1,147 @@
+/**
+ * @file pipes.c
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to size pipes
+ * and show stats of recent pipelines.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/commands/internal/pipes.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argument_validity.h"
+#include <jd/error.h>
+#include <jd/string.h>
+#include <myshell/pipes.h>
+
+static char *helpMessage() {
+  return "pipes - size pipes and show stats of recent pipelines\n"
+         "Lists the bytes each process of recent pipelines read and wrote,\n"
+         "the time it spent off the CPU, stalled on its pipes or otherwise,\n"
+         "and the times it gave up the CPU to wait. With -s, pipes are\n"
+         "created to hold SIZE bytes, with an optional K, M or G suffix, or\n"
+         "the kernel's default for 0\n"
+         "pipes [-s SIZE]\n";
+}
+
+/**
+ * @brief Seconds from start to end
+ *
+ */
+static double elapsed(const struct timespec start, const struct timespec end) {
+  return (double)(end.tv_sec - start.tv_sec) +
+         (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+/**
+ * @brief Seconds of CPU time in usage
+ *
+ */
+static double cpuTime(const struct rusage *const usage) {
+  return (double)(usage->ru_utime.tv_sec + usage->ru_stime.tv_sec) +
+         (double)(usage->ru_utime.tv_usec + usage->ru_stime.tv_usec) / 1e6;
+}
+
+/**
+ * @brief Reads size as bytes, with an optional binary K, M or G suffix
+ *
+ * @return true size is a number of bytes
+ * @return false size isn't a number of bytes
+ */
+static bool parseSize(const char *const size, size_t *const bytes) {
+  char *end;
+  const unsigned long long number = strtoull(size, &end, 10);
+  if (end == size || size[0] == '-') {
+    return false;
+  }
+  const char *const suffixes = "KMG";
+  const char *suffix = (char *)NULL;
+  if (*end != '\0') {
+    suffix = strchr(suffixes, *end++);
+    if (suffix == (char *)NULL || *suffix == '\0' || *end != '\0') {
+      return false;
+    }
+  }
+  const unsigned shift =
+      suffix != (char *)NULL ? 10 * (unsigned)(suffix - suffixes + 1) : 0;
+  if (number > (SIZE_MAX >> shift)) {
+    return false;
+  }
+  *bytes = (size_t)(number << shift);
+  return true;
+}
+
+/**
+ * @brief Prints the stats of pipeline, one line per process
+ *
+ */
+static void printStats(const PipelineStats *const stats) {
+  printf("[%u] %s\n", stats->jobId, stats->command);
+  if (stats->pipeCapacity != 0) {
+    printf("    pipes of %zu bytes", stats->pipeCapacity);
+  } else {
+    printf("    no pipes");
+  }
+  if (stats->bytesFed != 0) {
+    printf(", %zu bytes fed by internal commands, stalled %.3fs",
+           stats->bytesFed, stats->feedStall);
+  }
+  printf("\n    %-8s %12s %12s %9s %9s %9s\n", "pid", "read", "written", "cpu",
+         "stalled", "switches");
+  for (size_t stageIdx = 0; stageIdx < stats->numStages; ++stageIdx) {
+    const Stage *const stage = &stats->stages[stageIdx];
+    const double cpu = cpuTime(&stage->usage.usage);
+    const double wall = elapsed(stage->launched, stage->reaped);
+    printf("    %-8i %12llu %12llu %8.3fs %8.3fs %9li\n", stage->pid,
+           stage->usage.bytesRead, stage->usage.bytesWritten, cpu,
+           wall > cpu ? wall - cpu : 0, stage->usage.usage.ru_nvcsw);
+  }
+}
+
+int executePipes(const char *const commandName,
+                 const Vector *const commandArgs) {
+  const char fooName[] = "executePipes";
+  const int err = argumentValidityCheck(commandName, commandArgs, fooName);
+  if (err != 0) {
+    return err;
+  }
+
+  // List the setting, then the stats of each recent pipeline, oldest first
+  if (commandArgs->length == 1) {
+    if (pipes_size() == 0) {
+      printf("pipe size: default\n");
+    } else {
+      printf("pipe size: %zu bytes\n", pipes_size());
+    }
+    for (size_t age = PIPES_STATS_KEPT; age > 0; --age) {
+      const PipelineStats *const stats = pipes_stats(age - 1);
+      if (stats != (PipelineStats *)NULL) {
+        printStats(stats);
+      }
+    }
+    return errno;
+  }
+
+  // Size pipes created from now on
+  const String *const option = (String *)vector_atUnchecked(commandArgs, 1);
+  size_t size;
+  if (commandArgs->length != 3 || string_compareChar(option, "-s") ||
+      !parseSize(string_constData((String *)vector_atUnchecked(commandArgs, 2)),
+                 &size)) {
+    fprintf(stderr, "Incorrect arguments provided to %s in %s\n%s\n",
+            PIPES_COMMAND_NAME, fooName, helpMessage());
+    errno = EINVAL;
+    return errno;
+  }
+  pipes_setSize(size);
+  errno = 0;
+  return errno;
+}
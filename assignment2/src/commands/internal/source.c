@@ -0,0 +1,73 @@
+/**
+ * @file source.c
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to run a script
+ * in myshell itself.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/commands/internal/source.h>
+
+#include <stdio.h>
+
+#include "argument_validity.h"
+#include <jd/error.h>
+#include <jd/string.h>
+#include <myshell/execute.h>
+#include <myshell/script_cache.h>
+
+// scripts sourced within each other at most, before giving up on recursion
+#define SOURCE_MAX_DEPTH 64
+
+// scripts being sourced within each other
+static unsigned depth = 0;
+
+static char *helpMessage() {
+  return "source - run a script in myshell\n"
+         "Runs each command of FILE in this shell, rather than a new one.\n"
+         "Scripts are parsed once, and again only once they change\n"
+         "source FILE\n";
+}
+
+int executeSource(const char *const commandName,
+                  const Vector *const commandArgs) {
+  const char fooName[] = "executeSource";
+  const int err = argumentValidityCheck(commandName, commandArgs, fooName);
+  if (err != 0) {
+    return err;
+  }
+  if (commandArgs->length != 2) {
+    fprintf(stderr, "Incorrect arguments provided to %s in %s\n%s\n",
+            SOURCE_COMMAND_NAME, fooName, helpMessage());
+    errno = EPERM;
+    return errno;
+  }
+  if (depth == SOURCE_MAX_DEPTH) {
+    fprintf(stderr, "%s: scripts nested over %u deep\n", commandName,
+            SOURCE_MAX_DEPTH);
+    errno = ELOOP;
+    return errno;
+  }
+
+  // Run the script, parsed now or earlier
+  const String *const path = (String *)vector_atUnchecked(commandArgs, 1);
+  const Script *const script = scriptCache_acquire(string_constData(path));
+  if (script == (Script *)NULL) {
+    return errno; // errno set by scriptCache_acquire
+  }
+  ++depth;
+  const bool executed = execute_script(script);
+  const int result = errno;
+  --depth;
+  scriptCache_release(script);
+  if (!executed) {
+    fprintf(stderr, "Failure running script %s in %s\n",
+            string_constData(path), fooName);
+    return result; // errno set by execute_script
+  }
+  return 0;
+}
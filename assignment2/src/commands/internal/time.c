@@ -0,0 +1,64 @@
+/**
+ * @file time.c
+ * @author Justen Di Ruscio
+ * @brief Contents related to the handling of internal command to time every
+ * pipeline, or show whether it does. Single pipelines are timed by the time
+ * keyword starting them instead.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/commands/internal/time.h>
+
+#include <stdio.h>
+
+#include "argument_validity.h"
+#include <jd/error.h>
+#include <jd/string.h>
+#include <myshell/timing.h>
+
+static char *helpMessage() {
+  return "time - time pipelines, process by process\n"
+         "Started by time, a pipeline reports the real, user and system time,\n"
+         "the peak memory and the voluntary and involuntary context switches\n"
+         "of each of its processes on stderr once it finishes. With -a on,\n"
+         "every pipeline is timed, until -a off\n"
+         "time PIPELINE\n"
+         "time [-a on|off]\n";
+}
+
+int executeTime(const char *const commandName,
+                const Vector *const commandArgs) {
+  const char fooName[] = "executeTime";
+  const int err = argumentValidityCheck(commandName, commandArgs, fooName);
+  if (err != 0) {
+    return err;
+  }
+
+  // Show the setting
+  if (commandArgs->length == 1) {
+    printf("time every pipeline: %s\n", timing_always() ? "on" : "off");
+    return errno;
+  }
+
+  // Time every pipeline from now on, or stop. Any other argument is a
+  // command not starting its pipeline, which time can't start
+  const String *const option = (String *)vector_atUnchecked(commandArgs, 1);
+  const String *const setting =
+      commandArgs->length == 3 ? (String *)vector_atUnchecked(commandArgs, 2)
+                               : (String *)NULL;
+  if (setting == (String *)NULL || string_compareChar(option, "-a") ||
+      (string_compareChar(setting, "on") &&
+       string_compareChar(setting, "off"))) {
+    fprintf(stderr, "Incorrect arguments provided to %s in %s\n%s\n",
+            TIME_COMMAND_NAME, fooName, helpMessage());
+    errno = EINVAL;
+    return errno;
+  }
+  timing_setAlways(!string_compareChar(setting, "on"));
+  errno = 0;
+  return errno;
+}
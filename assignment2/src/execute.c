@@ -0,0 +1,282 @@
+/**
+ * @file execute.c
+ * @author Justen Di Ruscio
+ * @brief Execution of parsed pipelines and scripts. Each pipeline with system
+ * commands runs as a job, waited on unless it's in the background.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/execute.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <jd/error.h>
+#include <myshell/job_table.h>
+#include <myshell/pipe_feed.h>
+#include <myshell/pipes.h>
+#include <myshell/reaper.h>
+#include <myshell/redirect.h>
+#include <myshell/terminal.h>
+#include <myshell/timing.h>
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Runs internal command in myshell, with its descriptors arranged
+ * while it runs. Output into a pipe is written to feed, to be fed into the
+ * pipe, rather than forking a process to write it. Failures of the command
+ * itself are reported. Sets errno upon error.
+ *
+ * @param stdinFd read end of the pipe into command, or -1
+ * @param stdoutFd write end of the pipe out of command, or -1, owned by feed
+ * from then on
+ * @param feed feed of the pipe out of command, constructed if there's one
+ * @return true command was run, or its failure reported
+ * @return false an error occurred which myshell can't carry on from
+ */
+static bool runInternal(const Command *const command, const int stdinFd,
+                        const int stdoutFd, PipeFeed *const feed) {
+  if (stdoutFd != -1 && !pipeFeed_construct(feed, stdoutFd)) {
+    return false; // errno set by pipeFeed_construct
+  }
+
+  // Arrange descriptors, then run command
+  const size_t numRedirections = command->redirections.length;
+  LaunchFd fds[numRedirections + 2];
+  SavedFd saved[numRedirections + 2];
+  int opened[numRedirections + 1];
+  size_t numFds = 0, numSaved = 0;
+  if (redirect_arrange(command, stdinFd, feed->source, fds, &numFds,
+                       opened)) {
+    if (redirect_apply(fds, numFds, saved, &numSaved)) {
+      // Failures are reported where its stderr is redirected
+      const int result = execInternal(command->name, &command->args);
+      if (result != 0) {
+        fprintf(stderr, "Error executing internal command\n");
+        handleErrorMsg(result);
+      }
+      redirect_restore(saved, numSaved);
+    } else {
+      fprintf(stderr, "Failure redirecting internal command\n");
+      handleErrorMsg(errno);
+    }
+    redirect_close(opened, numRedirections);
+  }
+
+  // Feed what fits of its output now, as the command reading it may not be
+  // launched yet
+  const bool fed = pipeFeed_feed(feed, false);
+  if (pipeFeed_done(feed)) {
+    pipeFeed_freeData(feed);
+  }
+  return fed; // errno set by pipeFeed_feed
+}
+
+/**
+ * @brief Launches system command into the job with jobId, adding the job
+ * first if it's the pipeline's first system command to launch. Failures of
+ * the command itself are reported. Sets errno upon error.
+ *
+ * @param jobId id of the pipeline's job, or 0 to add it
+ * @return true command was launched, or its failure reported
+ * @return false failed to add the job
+ */
+static bool launchSystem(const Pipeline *const pipeline,
+                         const Command *const command, unsigned *const jobId,
+                         const int stdinFd, const int stdoutFd) {
+  // Add the pipeline's job with its first system command. Jobs get process
+  // groups of their own under job control, on a terminal
+  const bool jobControl = terminal_fd() != -1;
+  Job *job = jobTable_find(*jobId);
+  if (job == (Job *)NULL) {
+    job = jobTable_add(pipeline->text,
+                       pipeline->background ? JobBackground : JobForeground,
+                       jobControl);
+    if (job == (Job *)NULL) {
+      fprintf(stderr, "Failure adding job to the job table\n");
+      return false; // errno set by jobTable_add
+    }
+    job->timed = pipeline->timed || timing_always();
+    *jobId = job->id;
+  }
+
+  // Connect command to the pipes on either side of it, or the files it's
+  // redirected to, in the job's process group
+  const size_t numRedirections = command->redirections.length;
+  LaunchFd fds[numRedirections + 2];
+  int opened[numRedirections + 1];
+  LaunchIo io = {.fds = fds,
+                 .numFds = 0,
+                 .pgid = jobControl ? job->pgid : -1,
+                 .terminalFd = pipeline->background ? -1 : terminal_fd()};
+  if (!redirect_arrange(command, stdinFd, stdoutFd, fds, &io.numFds,
+                        opened)) {
+    errno = 0;
+    return true; // reported by redirect_arrange
+  }
+
+  // Run system command
+  const String *const name = (String *)vector_atUnchecked(&command->args, 0);
+  const pid_t pid = execSystem(&command->args, &io);
+  if (pid == -1) {
+    fprintf(stderr, "Error executing system command\n");
+    handleErrorMsg(errno);
+  } else if (!jobTable_addProcess(job, pid, string_constData(name))) {
+    fprintf(stderr, "Failure adding child %i to job %u\n", pid, job->id);
+    handleErrorMsg(errno);
+  }
+  redirect_close(opened, numRedirections);
+  errno = 0;
+  return true;
+}
+
+/**
+ * @brief Frees each feed, closing the pipes they feed
+ *
+ */
+static void freeFeeds(PipeFeed *const feeds, const size_t numFeeds) {
+  for (size_t feedIdx = 0; feedIdx < numFeeds; ++feedIdx) {
+    pipeFeed_freeData(&feeds[feedIdx]);
+  }
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+bool execute_pipeline(const Pipeline *const pipeline) {
+  const char fooName[] = "execute_pipeline";
+
+  // Argument Validity Check
+  errno = 0;
+  if (pipeline == (Pipeline *)NULL) {
+    fprintf(stderr, "argument 'pipeline' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // For each piped command, run command and pipe them together. System
+  // commands are launched into one job, as a process group. Pipes are closed
+  // on exec, so each child only keeps the ends it's connected to. Internal
+  // commands run in myshell, feeding their output into their pipe
+  // Timed pipelines of internal commands alone are reported from what
+  // myshell used while running them, having no job
+  TimingMark mark;
+  const bool timed =
+      (pipeline->timed || timing_always()) && timing_mark(&mark);
+
+  const size_t numCmds = pipeline->commands.length;
+  PipeFeed feeds[numCmds];
+  for (size_t cmdIdx = 0; cmdIdx < numCmds; ++cmdIdx) {
+    feeds[cmdIdx] = pipeFeed_constructEmpty();
+  }
+  unsigned jobId = 0;
+  size_t pipeCapacity = 0; // bytes each pipe holds
+  int pipeRead = -1;       // read end of the pipe from the previous command
+  for (size_t cmdIdx = 0; cmdIdx < numCmds; ++cmdIdx) {
+    const Command *const command =
+        (Command *)vector_atUnchecked(&pipeline->commands, cmdIdx);
+    int pipeDes[2] = {-1, -1};
+    if (cmdIdx < numCmds - 1 && !pipes_create(pipeDes, &pipeCapacity)) {
+      fprintf(stderr, "Failure creating pipes between commands in %s\n",
+              fooName);
+      if (pipeRead != -1) {
+        close(pipeRead);
+      }
+      freeFeeds(feeds, numCmds);
+      return false; // errno set by pipes_create
+    }
+
+    // Execute Internal Command, in myshell rather than the pipeline
+    bool ran;
+    if (command->name != Unknown) {
+      ran = runInternal(command, pipeRead, pipeDes[1], &feeds[cmdIdx]);
+      pipeDes[1] = -1; // owned by the feed
+    }
+    // Execute System Command
+    else {
+      ran = launchSystem(pipeline, command, &jobId, pipeRead, pipeDes[1]);
+    }
+
+    // Close file descriptors for pipe, which the children now hold
+    if (pipeRead != -1) {
+      close(pipeRead);
+    }
+    if (pipeDes[1] != -1) {
+      close(pipeDes[1]);
+    }
+    pipeRead = pipeDes[0]; // update read end of pipe for next cmd
+    if (!ran) {
+      if (pipeRead != -1) {
+        close(pipeRead);
+      }
+      freeFeeds(feeds, numCmds);
+      return false; // errno set by runInternal or launchSystem
+    }
+  }
+
+  // Feed the rest of internal commands' output, now that the commands reading
+  // it are launched, then close their pipes to end it. What's fed and how
+  // long it took count towards the job's stats
+  Job *const job = jobTable_find(jobId);
+  for (size_t cmdIdx = 0; cmdIdx < numCmds; ++cmdIdx) {
+    PipeFeed *const feed = &feeds[cmdIdx];
+    if (!pipeFeed_feed(feed, true)) {
+      freeFeeds(feeds, numCmds);
+      return false; // errno set by pipeFeed_feed
+    }
+    if (job != (Job *)NULL) {
+      job->bytesFed += (size_t)feed->offset;
+      job->feedStall += feed->stalled;
+    }
+    pipeFeed_freeData(feed);
+  }
+  if (job != (Job *)NULL) {
+    job->pipeCapacity = pipeCapacity;
+  }
+
+  // After all commands have been launched, report a background job, or reap
+  // each process of a foreground job as they finish or get stopped, in
+  // whichever order they do so
+  if (job == (Job *)NULL && timed) {
+    timing_printSince(&mark, pipeline->text, stderr);
+  } else if (job != (Job *)NULL && job->numProcesses == 0) {
+    jobTable_remove(job); // no command could be launched
+  } else if (job != (Job *)NULL && pipeline->background) {
+    printf("[%u] %i\n", job->id, job->pgid);
+  } else if (job != (Job *)NULL) {
+    const bool waited = reaper_waitForeground(jobId);
+    if (!waited) {
+      fprintf(stderr, "Failed to wait for foreground job %u in %s\n", jobId,
+              fooName);
+      return false; // errno set by reaper_waitForeground
+    }
+  }
+  errno = 0;
+  return true;
+}
+
+bool execute_script(const Script *const script) {
+  const char fooName[] = "execute_script";
+
+  // Argument Validity Check
+  errno = 0;
+  if (script == (Script *)NULL) {
+    fprintf(stderr, "argument 'script' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  for (size_t pIdx = 0; pIdx < script->pipelines.length; ++pIdx) {
+    const Pipeline *const pipeline =
+        (Pipeline *)vector_atUnchecked(&script->pipelines, pIdx);
+    if (!execute_pipeline(pipeline)) {
+      return false; // errno set by execute_pipeline
+    }
+  }
+  return true;
+}
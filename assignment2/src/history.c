@@ -0,0 +1,340 @@
+/**
+ * @file history.c
+ * @author Justen Di Ruscio
+ * @brief History of command lines, kept in a file appended to by every
+ * session of myshell. The file is mapped into memory and indexed by the
+ * offset of each line, so entries are found without reading it, and lines
+ * appended by other sessions are picked up as the file grows. Entries are
+ * numbered from 1, oldest first.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _GNU_SOURCE // mremap, memmem
+
+#include <myshell/history.h>
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <jd/vector.h>
+
+// bytes of history searched at once, from the most recent entries back, so
+// recent matches are found without searching all of it
+#define SEARCH_CHUNK (1 << 16)
+
+// history file, or -1 until history is opened
+static int historyFd = -1;
+
+// mapping of the history file, or NULL while it's empty
+static const char *mapped = (char *)NULL;
+static size_t mappedSize = 0;
+
+// offset of each entry in the history file as uint32_t, half the size of a
+// pointer to it
+static Vector offsets = {.data = NULL,
+                         .length = 0,
+                         .capacity = 0,
+                         .dataSize = sizeof(uint32_t)};
+
+// offset just past the newline of the last entry indexed
+static size_t indexedEnd = 0;
+
+// ==================== PRIVATE FUNCTIONS ===============
+static void unmap(void) {
+  if (mapped != (char *)NULL) {
+    munmap((void *)mapped, mappedSize);
+  }
+  mapped = (char *)NULL;
+  mappedSize = 0;
+  vector_clear(&offsets);
+  indexedEnd = 0;
+}
+
+/**
+ * @brief Offset of entry index in the history file
+ *
+ */
+static size_t entryOffset(const size_t index) {
+  return *(uint32_t *)vector_atUnchecked(&offsets, index);
+}
+
+/**
+ * @brief Index of the entry holding offset of the history file
+ *
+ */
+static size_t entryAt(const size_t offset) {
+  size_t low = 0, high = offsets.length;
+  while (high - low > 1) {
+    const size_t middle = low + (high - low) / 2;
+    if (entryOffset(middle) <= offset) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+/**
+ * @brief Maps what other sessions appended to the history file since it was
+ * last mapped, and indexes each complete line of it. A file that shrank, by
+ * being cleared for instance, is indexed again. Sets errno upon error.
+ *
+ * @return true successfully mapped and indexed the history file
+ * @return false an error occurred
+ */
+static bool refresh(void) {
+  if (historyFd == -1) {
+    return true;
+  }
+  struct stat status;
+  if (fstat(historyFd, &status) == -1) {
+    return false; // errno set by fstat
+  }
+  const size_t size = (size_t)status.st_size;
+  if (size == mappedSize) {
+    return true;
+  }
+  if (size > UINT32_MAX) {
+    errno = EFBIG;
+    return false; // offsets can't index it
+  }
+  if (size < mappedSize) {
+    unmap();
+  }
+  if (size == 0) {
+    return true;
+  }
+
+  // Map the whole file, moving the mapping if it can't grow in place
+  void *const map =
+      mapped == (char *)NULL
+          ? mmap(NULL, size, PROT_READ, MAP_SHARED, historyFd, 0)
+          : mremap((void *)mapped, mappedSize, size, MREMAP_MAYMOVE);
+  if (map == MAP_FAILED) {
+    return false; // errno set by mmap or mremap
+  }
+  mapped = map;
+  mappedSize = size;
+
+  // Index each line past those indexed, leaving a line still being written
+  while (indexedEnd < mappedSize) {
+    const char *const newline =
+        memchr(mapped + indexedEnd, '\n', mappedSize - indexedEnd);
+    if (newline == (char *)NULL) {
+      break;
+    }
+    const uint32_t offset = (uint32_t)indexedEnd;
+    if (!vector_pushBack(&offsets, &offset)) {
+      return false; // errno set by vector_pushBack
+    }
+    indexedEnd = (size_t)(newline - mapped) + 1;
+  }
+  return true;
+}
+
+static bool isBlank(const char c) { return c == ' ' || c == '\t'; }
+
+// ==================== PUBLIC FUNCTIONS ===============
+bool history_open(const char *const path) {
+  const char fooName[] = "history_open";
+
+  // Argument Validity Check
+  errno = 0;
+  if (path == (char *)NULL) {
+    fprintf(stderr, "argument 'path' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  history_close();
+  historyFd = open(path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+  if (historyFd == -1) {
+    fprintf(stderr, "Failure opening history file %s in %s\n", path,
+            fooName);
+    return false; // errno set by open
+  }
+  if (!refresh()) {
+    fprintf(stderr, "Failure reading history file %s in %s\n", path, fooName);
+    const int refreshErr = errno;
+    history_close();
+    errno = refreshErr;
+    return false; // errno set by refresh
+  }
+  return true;
+}
+
+bool history_add(const StringView line) {
+  const char fooName[] = "history_add";
+  errno = 0;
+  if (historyFd == -1 || line.length == 0) {
+    return true;
+  }
+  if (memchr(line.data, '\n', line.length) != NULL) {
+    fprintf(stderr, "Lines of history can't hold newlines in %s\n", fooName);
+    errno = EINVAL;
+    return false;
+  }
+
+  // Skip repeats of the most recent entry
+  const size_t count = history_count();
+  const StringView last = history_entry(count);
+  if (count != 0 && last.length == line.length &&
+      memcmp(last.data, line.data, line.length) == 0) {
+    return true;
+  }
+
+  // Append the line and its newline in a single write
+  const struct iovec parts[2] = {
+      {.iov_base = (void *)line.data, .iov_len = line.length},
+      {.iov_base = "\n", .iov_len = 1}};
+  const ssize_t written = writev(historyFd, parts, 2);
+  if (written != (ssize_t)line.length + 1) {
+    fprintf(stderr, "Failure appending to history file in %s\n", fooName);
+    if (written != -1) {
+      errno = EIO;
+    }
+    return false; // errno set by writev
+  }
+  return refresh(); // errno set by refresh
+}
+
+size_t history_count(void) {
+  refresh(); // entries indexed so far are still valid
+  return offsets.length;
+}
+
+StringView history_entry(const size_t number) {
+  if (number == 0 || number > offsets.length) {
+    return (StringView){.data = "", .length = 0};
+  }
+  const size_t start = entryOffset(number - 1);
+  const size_t end =
+      number < offsets.length ? entryOffset(number) : indexedEnd;
+  return (StringView){.data = mapped + start, .length = end - start - 1};
+}
+
+size_t history_findPrefix(const StringView prefix) {
+  for (size_t number = history_count(); number > 0; --number) {
+    const StringView entry = history_entry(number);
+    if (entry.length >= prefix.length &&
+        memcmp(entry.data, prefix.data, prefix.length) == 0) {
+      return number;
+    }
+  }
+  return 0;
+}
+
+size_t history_search(const StringView text, const size_t before) {
+  const size_t count = history_count();
+  if (text.length == 0 || count == 0 ||
+      memchr(text.data, '\n', text.length) != NULL) {
+    return 0;
+  }
+
+  // Search chunks of whole entries, from the one before entry before back.
+  // Text has no newline, so each match lies within one entry
+  size_t end = before == 0 ? 0 : before > count ? indexedEnd
+                                                : entryOffset(before - 1);
+  while (end > 0) {
+    const size_t from = end > SEARCH_CHUNK ? end - SEARCH_CHUNK : 0;
+    const size_t start = entryOffset(entryAt(from));
+    const char *last = (char *)NULL;
+    const char *match = mapped + start;
+    while ((match = memmem(match, (size_t)(mapped + end - match), text.data,
+                           text.length)) != (char *)NULL) {
+      last = match++;
+    }
+    if (last != (char *)NULL) {
+      return entryAt((size_t)(last - mapped)) + 1;
+    }
+    end = start;
+  }
+  return 0;
+}
+
+bool history_expand(String *const line) {
+  const char fooName[] = "history_expand";
+
+  // Argument Validity Check
+  errno = 0;
+  if (line == (String *)NULL) {
+    fprintf(stderr, "argument 'line' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Events start the line with ! followed by the event, up to a blank
+  const char *chars = string_constData(line);
+  if (line->length < 2 || chars[0] != '!' || isBlank(chars[1])) {
+    return true;
+  }
+  size_t eventLength = 1;
+  while (1 + eventLength < line->length && !isBlank(chars[1 + eventLength])) {
+    ++eventLength;
+  }
+  const StringView event = {.data = chars + 1, .length = eventLength};
+
+  // Find the entry the event refers to
+  const size_t count = history_count();
+  size_t number = 0;
+  const bool relative = event.data[0] == '-';
+  size_t digits = relative;
+  while (digits < event.length && isdigit((unsigned char)event.data[digits])) {
+    ++digits;
+  }
+  if (event.length == 1 && event.data[0] == '!') {
+    number = count;
+  } else if (digits == event.length && digits > (size_t)relative) {
+    const size_t n = strtoul(event.data + relative, NULL, 10);
+    number = !relative ? n : n <= count ? count - n + 1 : 0;
+  } else {
+    number = history_findPrefix(event);
+  }
+  if (number == 0 || number > count) {
+    fprintf(stderr, "!%.*s: event not found\n", (int)event.length,
+            event.data);
+    errno = ENOENT;
+    return false;
+  }
+
+  // Replace the event with the entry, which is mapped rather than in line
+  const StringView entry = history_entry(number);
+  const size_t restLength = line->length - 1 - eventLength;
+  const size_t length = entry.length + restLength;
+  if (!string_reserve(line, length + 1)) {
+    return false; // errno set by string_reserve
+  }
+  char *const expanded = string_data(line);
+  memmove(expanded + entry.length, expanded + 1 + eventLength, restLength);
+  memcpy(expanded, entry.data, entry.length);
+  expanded[length] = '\0';
+  line->length = length;
+  printf("%s\n", expanded);
+  return true;
+}
+
+void history_close(void) {
+  unmap();
+  vector_freeData(&offsets);
+  offsets = vector_constructEmpty(sizeof(uint32_t));
+  if (historyFd != -1) {
+    close(historyFd);
+  }
+  historyFd = -1;
+}
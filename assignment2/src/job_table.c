@@ -0,0 +1,361 @@
+/**
+ * @file job_table.c
+ * @author Justen Di Ruscio
+ * @brief Table of the jobs of myshell. Each job is a command line launched as
+ * its own process group, found in constant time by its job id, its process
+ * group ID or the PID of any of its processes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <myshell/job_table.h>
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+
+#include <jd/hashmap.h>
+
+/**
+ * @brief A process of a job, not reaped yet
+ *
+ */
+typedef struct JobProcess {
+  unsigned jobId;
+  size_t stage; // index of the process in its job's stages
+  bool stopped;
+} JobProcess;
+
+HASHMAP_DECLARE_TYPED(PgidJobs, pgidJobs, pid_t, unsigned, NULL, NULL)
+HASHMAP_DECLARE_TYPED(PidJobs, pidJobs, pid_t, JobProcess, NULL, NULL)
+
+// Job* of each job, at index id - 1, or NULL for ids not in use. Never ends
+// in NULL, so the next job's id is one past its length
+static Vector jobs = {.data = NULL,
+                      .length = 0,
+                      .capacity = 0,
+                      .dataSize = sizeof(Job *)};
+
+// job id of each process group and process, constructed on first use
+static PgidJobs pgids;
+static PidJobs pids;
+static bool mapsConstructed = false;
+
+// number of jobs in each state
+static size_t stateCounts[numJobStates];
+
+// id of the most recently suspended or added job
+static unsigned currentId = 0;
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Counts every process of job as running
+ *
+ */
+static void continueProcesses(Job *const job) {
+  for (size_t stageIdx = 0; stageIdx < job->stages.length; ++stageIdx) {
+    const Stage *const stage =
+        (Stage *)vector_atUnchecked(&job->stages, stageIdx);
+    JobProcess *const process = pidJobs_find(&pids, stage->pid);
+    if (process != (JobProcess *)NULL) {
+      process->stopped = false;
+    }
+  }
+  job->numStopped = 0;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+Job *jobTable_add(const StringView command, const JobState state,
+                  const bool grouped) {
+  const char fooName[] = "jobTable_add";
+
+  // Argument Validity Check
+  errno = 0;
+  if (command.data == (char *)NULL) {
+    fprintf(stderr, "argument 'command' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return (Job *)NULL;
+  }
+
+  if (!mapsConstructed) {
+    pgids = pgidJobs_constructEmpty();
+    pids = pidJobs_constructEmpty();
+    mapsConstructed = true;
+  }
+
+  // Construct job
+  Job *const job = malloc(sizeof(Job));
+  if (job == (Job *)NULL) {
+    return job; // errno set by malloc
+  }
+  *job = (Job){.id = jobs.length + 1,
+               .pgid = 0,
+               .grouped = grouped,
+               .state = state,
+               .numProcesses = 0,
+               .numStopped = 0,
+               .lastPid = 0,
+               .status = 0,
+               .stages = vector_constructEmpty(sizeof(Stage)),
+               .pipeCapacity = 0,
+               .bytesFed = 0,
+               .feedStall = 0,
+               .timed = false,
+               .command = strndup(command.data, command.length),
+               .hasModes = false};
+  if (job->command == (char *)NULL || !vector_pushBack(&jobs, &job)) {
+    free(job->command);
+    free(job);
+    return (Job *)NULL; // errno set by strndup or vector_pushBack
+  }
+  ++stateCounts[state];
+  if (state != JobForeground) {
+    currentId = job->id;
+  }
+  return job;
+}
+
+bool jobTable_addProcess(Job *const job, const pid_t pid,
+                         const char *const name) {
+  const char fooName[] = "jobTable_addProcess";
+
+  // Argument Validity Check
+  errno = 0;
+  if (job == (Job *)NULL || name == (char *)NULL) {
+    fprintf(stderr, "arguments of %s must point to valid addresses\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // The first process leads the job's process group
+  const bool leader = job->stages.length == 0;
+  if (leader && !pgidJobs_insert(&pgids, pid, job->id)) {
+    return false; // errno set by pgidJobs_insert
+  }
+  const JobProcess process = {
+      .jobId = job->id, .stage = job->stages.length, .stopped = false};
+  Stage stage = {.pid = pid, .finished = false};
+  const char *const base = strrchr(name, '/');
+  snprintf(stage.name, sizeof(stage.name), "%s",
+           base != (char *)NULL ? base + 1 : name);
+  clock_gettime(CLOCK_MONOTONIC, &stage.launched);
+  if (!pidJobs_insert(&pids, pid, process) ||
+      !vector_pushBack(&job->stages, &stage)) {
+    pidJobs_erase(&pids, pid);
+    if (leader) {
+      pgidJobs_erase(&pgids, pid);
+    }
+    return false; // errno set by pidJobs_insert or vector_pushBack
+  }
+  if (leader) {
+    job->pgid = pid;
+  }
+  job->lastPid = pid;
+  ++job->numProcesses;
+  return true;
+}
+
+Job *jobTable_processChanged(const pid_t pid, const int status,
+                             const ProcessUsage *const usage) {
+  if (!mapsConstructed) {
+    return (Job *)NULL;
+  }
+  JobProcess *const process = pidJobs_find(&pids, pid);
+  if (process == (JobProcess *)NULL) {
+    return (Job *)NULL; // not launched by myshell
+  }
+  Job *const job = jobTable_find(process->jobId);
+
+  // Stopped, by Ctrl+Z for instance
+  if (WIFSTOPPED(status)) {
+    if (!process->stopped) {
+      process->stopped = true;
+      ++job->numStopped;
+    }
+  }
+  // Continued, by fg, bg or otherwise
+  else if (WIFCONTINUED(status)) {
+    if (process->stopped) {
+      process->stopped = false;
+      --job->numStopped;
+    }
+  }
+  // Exited or killed
+  else {
+    if (process->stopped) {
+      --job->numStopped;
+    }
+    if (pid == job->lastPid) {
+      job->status = status;
+    }
+    Stage *const stage =
+        (Stage *)vector_atUnchecked(&job->stages, process->stage);
+    clock_gettime(CLOCK_MONOTONIC, &stage->reaped);
+    stage->finished = true;
+    if (usage != (ProcessUsage *)NULL) {
+      stage->usage = *usage;
+    }
+    --job->numProcesses;
+    pidJobs_erase(&pids, pid);
+  }
+  return job;
+}
+
+void jobTable_setState(Job *const job, const JobState state) {
+  if (job == (Job *)NULL) {
+    return;
+  }
+  if (job->state == JobSuspended && state != JobSuspended) {
+    continueProcesses(job);
+  }
+  if (state == JobSuspended) {
+    currentId = job->id;
+  }
+  --stateCounts[job->state];
+  job->state = state;
+  ++stateCounts[state];
+}
+
+bool jobTable_signal(const Job *const job, const int sigNum) {
+  errno = 0;
+  if (job == (Job *)NULL) {
+    return true;
+  }
+  if (job->grouped) {
+    return kill(-job->pgid, sigNum) == 0; // errno set by kill
+  }
+  bool sent = true;
+  for (size_t stageIdx = 0; stageIdx < job->stages.length; ++stageIdx) {
+    const Stage *const stage =
+        (Stage *)vector_atUnchecked(&job->stages, stageIdx);
+    if (!stage->finished && kill(stage->pid, sigNum) == -1) {
+      sent = false; // errno set by kill
+    }
+  }
+  return sent;
+}
+
+void jobTable_remove(Job *const job) {
+  if (job == (Job *)NULL) {
+    return;
+  }
+
+  // Forget the job's process group and any process not reaped
+  for (size_t stageIdx = 0; stageIdx < job->stages.length; ++stageIdx) {
+    const Stage *const stage =
+        (Stage *)vector_atUnchecked(&job->stages, stageIdx);
+    pidJobs_erase(&pids, stage->pid);
+  }
+  pgidJobs_erase(&pgids, job->pgid);
+  --stateCounts[job->state];
+
+  // Free the job's id, along with any free ids before it at the end of jobs
+  *(Job **)vector_atUnchecked(&jobs, job->id - 1) = (Job *)NULL;
+  while (jobs.length != 0 && *(Job **)vector_back(&jobs) == (Job *)NULL) {
+    vector_erase(&jobs, jobs.length - 1);
+  }
+
+  vector_freeData(&job->stages);
+  free(job->command);
+  free(job);
+}
+
+Job *jobTable_find(const unsigned id) {
+  if (id == 0 || id > jobs.length) {
+    return (Job *)NULL;
+  }
+  return *(Job **)vector_atUnchecked(&jobs, id - 1);
+}
+
+Job *jobTable_findByPgid(const pid_t pgid) {
+  if (!mapsConstructed) {
+    return (Job *)NULL;
+  }
+  const unsigned *const id = pgidJobs_find(&pgids, pgid);
+  return id != (unsigned *)NULL ? jobTable_find(*id) : (Job *)NULL;
+}
+
+Job *jobTable_findByPid(const pid_t pid) {
+  if (!mapsConstructed) {
+    return (Job *)NULL;
+  }
+  const JobProcess *const process = pidJobs_find(&pids, pid);
+  return process != (JobProcess *)NULL ? jobTable_find(process->jobId)
+                                       : (Job *)NULL;
+}
+
+Job *jobTable_findSpec(const char *const spec) {
+  if (spec == (char *)NULL || spec[0] == '\0') {
+    return (Job *)NULL;
+  }
+
+  // %%, %+ or %N
+  if (spec[0] == '%') {
+    if (strcmp(spec, "%%") == 0 || strcmp(spec, "%+") == 0) {
+      return jobTable_current();
+    }
+    char *end;
+    const unsigned long id = strtoul(spec + 1, &end, 10);
+    return *end == '\0' && end != spec + 1 ? jobTable_find(id) : (Job *)NULL;
+  }
+
+  // PID or process group ID
+  char *end;
+  const long pid = strtol(spec, &end, 10);
+  if (*end != '\0' || pid <= 0) {
+    return (Job *)NULL;
+  }
+  Job *const job = jobTable_findByPgid(pid);
+  return job != (Job *)NULL ? job : jobTable_findByPid(pid);
+}
+
+Job *jobTable_current(void) {
+  Job *const current = jobTable_find(currentId);
+  if (current != (Job *)NULL && current->state != JobForeground) {
+    return current;
+  }
+  for (size_t jobIdx = jobs.length; jobIdx > 0; --jobIdx) {
+    Job *const job = *(Job **)vector_atUnchecked(&jobs, jobIdx - 1);
+    if (job != (Job *)NULL && job->state != JobForeground) {
+      return job;
+    }
+  }
+  return (Job *)NULL;
+}
+
+Job *jobTable_next(const unsigned id) {
+  for (size_t jobIdx = id > 0 ? id - 1 : 0; jobIdx < jobs.length; ++jobIdx) {
+    Job *const job = *(Job **)vector_atUnchecked(&jobs, jobIdx);
+    if (job != (Job *)NULL) {
+      return job;
+    }
+  }
+  return (Job *)NULL;
+}
+
+size_t jobTable_count(const JobState state) { return stateCounts[state]; }
+
+void jobTable_freeData(void) {
+  for (Job *job = jobTable_next(1); job != (Job *)NULL;
+       job = jobTable_next(1)) {
+    jobTable_remove(job);
+  }
+  vector_freeData(&jobs);
+  jobs = vector_constructEmpty(sizeof(Job *));
+  if (mapsConstructed) {
+    pgidJobs_freeData(&pgids);
+    pidJobs_freeData(&pids);
+    mapsConstructed = false;
+  }
+  currentId = 0;
+}
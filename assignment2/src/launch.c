@@ -0,0 +1,226 @@
+/**
+ * @file launch.c
+ * @author Justen Di Ruscio
+ * @brief Launching system commands as child processes of myshell, either with
+ * posix_spawn or by forking and exec'ing
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _GNU_SOURCE // posix_spawn_file_actions_addtcsetpgrp_np
+
+#include <myshell/launch.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <jd/error.h>
+
+extern char **environ;
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Adds the dup2s, closes and terminal handoff arranging io in the child
+ * to actions
+ *
+ * @param actions file actions of posix_spawn
+ * @param io descriptors to arrange
+ * @return int 0 upon success, otherwise a Unix error number
+ */
+static int addIoActions(posix_spawn_file_actions_t *const actions,
+                        const LaunchIo *const io) {
+  int err = 0;
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 35)
+  // Otherwise left to myshell after launching, which the child may race
+  if (io->terminalFd != -1) {
+    err = posix_spawn_file_actions_addtcsetpgrp_np(actions, io->terminalFd);
+  }
+#endif
+  for (size_t fdIdx = 0; err == 0 && fdIdx < io->numFds; ++fdIdx) {
+    const LaunchFd *const launchFd = &io->fds[fdIdx];
+    // dup2 of a descriptor onto itself clears its close-on-exec flag
+    err = launchFd->source != -1
+              ? posix_spawn_file_actions_adddup2(actions, launchFd->source,
+                                                 launchFd->fd)
+              : posix_spawn_file_actions_addclose(actions, launchFd->fd);
+  }
+  return err;
+}
+
+/**
+ * @brief Spawns argv with posix_spawn, or posix_spawnp without a path, which
+ * on Linux shares myshell's memory with the child until it execs instead of
+ * copying its page tables. Sets errno upon error, including the child's exec
+ * error.
+ *
+ * @return pid_t PID of the child, or -1 upon error
+ */
+static pid_t spawnCommand(const char *const path, char *const argv[],
+                          const LaunchIo *const io) {
+  const char fooName[] = "spawnCommand";
+
+  posix_spawn_file_actions_t actions;
+  posix_spawnattr_t attributes;
+  errno = posix_spawn_file_actions_init(&actions);
+  if (errno != 0) {
+    fprintf(stderr, "Failure initializing file actions in %s\n", fooName);
+    return -1;
+  }
+  errno = posix_spawnattr_init(&attributes);
+  if (errno != 0) {
+    fprintf(stderr, "Failure initializing spawn attributes in %s\n", fooName);
+    posix_spawn_file_actions_destroy(&actions);
+    return -1;
+  }
+
+  // Arrange io, restore the default action of terminal signals and SIGPIPE,
+  // which myshell handles or ignores itself, and unblock SIGCHLD, which
+  // myshell reads from a signalfd
+  sigset_t defaultSignals;
+  sigset_t noSignals;
+  sigemptyset(&defaultSignals);
+  sigaddset(&defaultSignals, SIGTSTP);
+  sigaddset(&defaultSignals, SIGTTIN);
+  sigaddset(&defaultSignals, SIGTTOU);
+  sigaddset(&defaultSignals, SIGPIPE);
+  sigemptyset(&noSignals);
+  short flags = POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK;
+  int err = io != (LaunchIo *)NULL ? addIoActions(&actions, io) : 0;
+  if (err == 0 && io != (LaunchIo *)NULL && io->pgid != -1) {
+    flags |= POSIX_SPAWN_SETPGROUP;
+    err = posix_spawnattr_setpgroup(&attributes, io->pgid);
+  }
+  if (err == 0) {
+    err = posix_spawnattr_setsigdefault(&attributes, &defaultSignals);
+  }
+  if (err == 0) {
+    err = posix_spawnattr_setsigmask(&attributes, &noSignals);
+  }
+  if (err == 0) {
+    err = posix_spawnattr_setflags(&attributes, flags);
+  }
+
+  // Spawn
+  pid_t pid = -1;
+  if (err == 0) {
+    err = path != (char *)NULL
+              ? posix_spawn(&pid, path, &actions, &attributes, argv, environ)
+              : posix_spawnp(&pid, argv[0], &actions, &attributes, argv,
+                             environ);
+  }
+  posix_spawnattr_destroy(&attributes);
+  posix_spawn_file_actions_destroy(&actions);
+  errno = err;
+  return err == 0 ? pid : -1;
+}
+
+/**
+ * @brief Forks, then arranges io and execs argv in the child. A child failing
+ * to do so reports the error and exits. Sets errno upon error.
+ *
+ * @return pid_t PID of the child, or -1 upon error
+ */
+static pid_t forkCommand(const char *const path, char *const argv[],
+                         const LaunchIo *const io) {
+  const char fooName[] = "forkCommand";
+
+  const pid_t pid = fork();
+  if (pid == -1) {
+    fprintf(stderr, "Unable to fork process %i in %s\n", getpid(), fooName);
+    return pid; // errno set by fork
+  }
+  // Join the process group in both processes, so it's joined whichever runs
+  // first
+  const bool grouped = io != (LaunchIo *)NULL && io->pgid != -1;
+  if (pid != 0) {
+    if (grouped) {
+      setpgid(pid, io->pgid); // fails once the child execs, having joined
+    }
+    return pid;
+  }
+
+  // Child process: join process group and take the terminal, while SIGTTOU
+  // is still ignored
+  if (grouped) {
+    setpgid(0, io->pgid);
+    if (io->terminalFd != -1) {
+      tcsetpgrp(io->terminalFd, getpgrp());
+    }
+  }
+
+  // Register default signal handlers
+  if (signal(SIGTSTP, SIG_DFL) == SIG_ERR ||
+      signal(SIGTTIN, SIG_DFL) == SIG_ERR ||
+      signal(SIGTTOU, SIG_DFL) == SIG_ERR ||
+      signal(SIGPIPE, SIG_DFL) == SIG_ERR) {
+    fprintf(stderr, "Failure registering default handlers for terminal "
+                    "signals and SIGPIPE\n");
+    handleErrorMsg(errno);
+    _exit(ECMDNOTFOUND);
+  }
+
+  // Unblock SIGCHLD, which myshell reads from a signalfd
+  sigset_t noSignals;
+  sigemptyset(&noSignals);
+  sigprocmask(SIG_SETMASK, &noSignals, NULL);
+
+  // Arrange descriptors, like pipes between commands and redirections
+  for (size_t fdIdx = 0; io != (LaunchIo *)NULL && fdIdx < io->numFds;
+       ++fdIdx) {
+    const LaunchFd *const launchFd = &io->fds[fdIdx];
+    int arranged;
+    if (launchFd->source == -1) {
+      arranged = close(launchFd->fd) == 0 || errno == EBADF ? 0 : -1;
+    } else if (launchFd->source == launchFd->fd) {
+      // dup2 leaves a descriptor copied onto itself close-on-exec
+      arranged = fcntl(launchFd->fd, F_SETFD, 0);
+    } else {
+      arranged = dup2(launchFd->source, launchFd->fd);
+    }
+    if (arranged == -1) {
+      fprintf(stderr, "Child %i failed to arrange descriptor %i\n", getpid(),
+              launchFd->fd);
+      handleErrorMsg(errno);
+      _exit(ECMDNOTFOUND);
+    }
+  }
+
+  // Run system command; execvp runs files without a #! line with /bin/sh, and
+  // only searches PATH for names without a '/'
+  execvp(path != (char *)NULL ? path : argv[0], argv);
+  fprintf(stderr, "Error executing system command\n");
+  handleErrorMsg(errno);
+  _exit(ECMDNOTFOUND);
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+pid_t launchCommand(const char *const path, char *const argv[],
+                    const LaunchIo *const io, const LaunchMode mode) {
+  const char fooName[] = "launchCommand";
+
+  // Argument Validity Check
+  errno = 0;
+  if (argv == (char *const *)NULL || argv[0] == (char *)NULL) {
+    fprintf(stderr, "argument 'argv' of %s must hold a command name\n",
+            fooName);
+    errno = EPERM;
+    return -1;
+  }
+
+  if (mode == LaunchSpawn) {
+    const pid_t pid = spawnCommand(path, argv, io);
+    // exec'ing files without a #! line is left to execvp, which runs them
+    // with /bin/sh
+    if (pid != -1 || errno != ENOEXEC) {
+      return pid;
+    }
+  }
+  return forkCommand(path, argv, io);
+}
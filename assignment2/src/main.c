@@ -12,68 +12,95 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/types.h>
-#include <sys/wait.h>
 #include <unistd.h>
 
+#include <jd/arena.h>
 #include <jd/error.h>
 #include <jd/string.h>
 #include <jd/vector.h>
 
-#include <myshell/commands/commands.h>
-#include <myshell/job_states.h>
+#include <myshell/execute.h>
+#include <myshell/history.h>
+#include <myshell/job_table.h>
+#include <myshell/pipes.h>
 #include <myshell/prompt.h>
+#include <myshell/reaper.h>
+#include <myshell/script_cache.h>
 #include <myshell/signal_handlers.h>
+#include <myshell/syntax.h>
+#include <myshell/terminal.h>
+
+// Common, persistent objects used in main(), empty until constructed there.
+// current working directory, shown in the prompt
+static String cwd;
+// user's input commands
+static String userInput;
+// arena each command line is parsed into, and released from all at once
+static Arena lineArena;
 
 // ========================== Exiting Program ============================
 /**
- * @brief Frees all of the arguments; the common, persistent objects used in
- * main()
+ * @brief Frees the common, persistent objects used in main(). Registered with
+ * atexit, so they're freed however myshell exits, exit command included
  *
- * @param cwd current working directory String
- * @param userInput user input to command line
- * @param inputCommands all of the piped input commands
- * @param commandArgs the current list of command args
- * @param numCommands number of piped commands
  */
-void freeAll(const String *const cwd, const String *const userInput,
-             const Vector *const inputCommands, const Vector *const commandArgs,
-             const unsigned numCommands) {
-  string_freeData(cwd);
-  string_freeData(userInput);
-  vector_freeElements(inputCommands);
-  vector_freeData(inputCommands);
-  if (commandArgs != (Vector *)NULL) {
-    // for each command, clear its set of arguments
-    for (unsigned cmdIdx = 0; cmdIdx < numCommands; ++cmdIdx) {
-      const Vector arguments = commandArgs[cmdIdx];
-      vector_freeElements(&arguments);
-      vector_freeData(&arguments);
-    }
-  }
+static void freeAll(void) {
+  string_freeData(&cwd);
+  string_freeData(&userInput);
+  arena_freeData(&lineArena);
+  scriptCache_freeData();
+  pipes_freeData();
+  history_close();
 }
 
+// ========================== Script Mode ============================
 /**
- * @brief Frees all of the arguments; the common, persistent objects used in
- * main(), and exits the program
+ * @brief Runs the script at path, as the source command does, then exits
+ * myshell. Scripts don't get job control; their jobs stay in myshell's process
+ * group
  *
- * @param cwd
- * @param userInput
- * @param inputCommands
- * @param commandArguments
- * @param numCommands
+ * @param path script to run
  */
-void freeAllAndExit(const String *const cwd, const String *const userInput,
-                    const Vector *const inputCommands,
-                    const Vector *const commandArguments,
-                    const size_t numCommands) {
-  const int exitCode = errno;
-  freeAll(cwd, userInput, inputCommands, commandArguments, numCommands);
-  handleExitError(exitCode);
+static void runScriptAndExit(const char *const path) {
+  const Script *const script = scriptCache_acquire(path);
+  if (script == (Script *)NULL) {
+    fprintf(stderr, "Failure reading script %s\n", path);
+    handleExitError(errno);
+  }
+  const bool executed = execute_script(script);
+  scriptCache_release(script);
+  if (!executed) {
+    fprintf(stderr, "Failure running script %s\n", path);
+    handleExitError(errno);
+  }
+  exit(EXIT_SUCCESS);
 }
 
 // ========================== Main ============================
-int main() {
+int main(int argc, char **argv) {
   int returnCode = EXIT_FAILURE;
+  if (atexit(freeAll) != 0) {
+    fprintf(stderr, "Failure registering cleanup of myshell at exit\n");
+    handleExitError(errno);
+  }
+
+  // Writing to a pipe with no reader fails with EPIPE instead of killing
+  // myshell, as internal commands write to pipes from myshell
+  if (signal(SIGPIPE, SIG_IGN) == SIG_ERR) {
+    fprintf(stderr, "Failure ignoring SIGPIPE (%i) signal\n", SIGPIPE);
+    handleExitError(errno);
+  }
+
+  // Reap children from a signalfd rather than a SIGCHLD handler
+  if (!reaper_init()) {
+    fprintf(stderr, "Failure initializing reaping of child processes\n");
+    handleExitError(errno);
+  }
+
+  // myshell script.sh runs script.sh rather than reading commands
+  if (argc >= 2) {
+    runScriptAndExit(argv[1]);
+  }
 
   // Register signal handler for myshell (parent process)
   const __sighandler_t registered = signal(SIGTSTP, handleSignal);
@@ -83,6 +110,12 @@ int main() {
     handleExitError(errno);
   }
 
+  // Take control of the terminal, to hand to each job in the foreground
+  if (!terminal_init()) {
+    fprintf(stderr, "Failure taking control of the terminal\n");
+    handleExitError(errno);
+  }
+
   // Construct initial string to store cwd
   const unsigned defaultCwdLength = 1 << 7;
   OptionalString cwdConstructed = string_constructCapacity(defaultCwdLength);
@@ -94,7 +127,7 @@ int main() {
     string_freeData(&cwdConstructed.data);
     handleExitError(errno);
   }
-  String cwd = cwdConstructed.data;
+  cwd = cwdConstructed.data;
 
   // String to store user's input commands
   const unsigned defaultInputLength = 1 << 8;
@@ -106,208 +139,66 @@ int main() {
     string_freeData(&inputOpt.data);
     handleExitError(errno);
   }
-  String userInput = inputOpt.data;
+  userInput = inputOpt.data;
+
+  // Arena each command line is parsed into
+  const size_t lineArenaBlockSize = 1 << 12;
+  lineArena = arena_construct(lineArenaBlockSize);
+
+  // History shared with other sessions, kept in the home directory. myshell
+  // runs without history if it can't be opened
+  const char *const home = getenv("HOME");
+  if (home != (char *)NULL) {
+    const int pathLength =
+        snprintf(NULL, 0, "%s/%s", home, HISTORY_FILE_NAME) + 1;
+    char historyPath[pathLength];
+    snprintf(historyPath, pathLength, "%s/%s", home, HISTORY_FILE_NAME);
+    if (!history_open(historyPath)) {
+      handleErrorMsg(errno);
+    }
+  }
 
   // Continuously wait for user input on command line
   while (true) {
-    // Print prompt and read user's commands
+    // Report jobs that finished or stopped, then print prompt and read user's
+    // commands
+    reaper_printNotifications();
     printPrompt(&cwd);
     const bool readValid = readInputLine(&userInput, NULL);
     if (!readValid) {
       fprintf(stderr, "Failure reading user input from command line\n");
-      freeAllAndExit(&cwd, &userInput, NULL, NULL, 0);
-    }
-
-    // Split command-line into piped commands
-    OptionalVector inputSplit = string_split(&userInput, PIPE_DELIMETER);
-    if (!inputSplit.valid) {
-      fprintf(stderr, "Unable to split user input into commands\n");
-      freeAllAndExit(&cwd, &userInput, &inputSplit.data, (Vector *)NULL,
-                     inputSplit.data.length);
+      handleExitError(errno);
     }
-    Vector inputCommands = inputSplit.data;
-
-    // Split each piped command into arguments. Do this before executing
-    // commands in order to validate command name is known
-
-    // create arrays to store vectors of split command args, and command names
-    const size_t numCmds = inputCommands.length;
-    Vector commandArgs[numCmds];
-    enum CommandName commandNames[numCmds];
-
-    // for each piped command, process command arguments
-    for (unsigned cmdIdx = 0; cmdIdx < inputCommands.length; ++cmdIdx) {
-      // Split command into arguments.
-      // access single piped command:
-      const String *inputCommand = (String *)vector_at(&inputCommands, cmdIdx);
-      if (inputCommand == (String *)NULL) {
-        fprintf(stderr, "Error accessing element %u of inputCommands\n",
-                cmdIdx);
-        freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs, numCmds);
-      }
-      // strip unnecessary chars from input command
-      const OptionalString optCmd =
-          string_strip(inputCommand, &defaultStripChars);
-      if (!optCmd.valid) {
-        fprintf(
-            stderr,
-            "Failure stripping unnecessary characters from input command %s\n",
-            inputCommand->data);
-        string_freeData(&optCmd.data);
-        freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs, numCmds);
-      }
-      const String cmd = optCmd.data;
-
-      // split single piped command into arguments
-      OptionalVector argumentSplit = string_split(&cmd, ARG_DELIMETER);
-      string_freeData(&cmd);
-      if (!argumentSplit.valid) {
-        fprintf(stderr, "Unable to split user command %u into arguments\n",
-                cmdIdx);
-        vector_freeElements(&argumentSplit.data);
-        vector_freeData(&argumentSplit.data);
-        freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs, numCmds);
-      }
-      Vector currentCmdArgs = argumentSplit.data;
-      currentCmdArgs.elementDeleter = string_freeDataVoid;
 
-      if (currentCmdArgs.length) {
-        // Determine and store command name from arg0, if known
-        String *arg0 = (String *)vector_at(&currentCmdArgs, 0);
-
-        enum CommandName name = parseCommandName(arg0);
-        commandNames[cmdIdx] = name;          // store resolved name
-        commandArgs[cmdIdx] = currentCmdArgs; // store split arguments
-      } else {
-        vector_freeElements(&currentCmdArgs);
-        vector_freeData(&currentCmdArgs);
+    // Expand a history event, like !!, then keep the line in history
+    if (!history_expand(&userInput)) {
+      if (errno != ENOENT) {
+        fprintf(stderr, "Failure expanding history in command line\n");
+        handleExitError(errno);
       }
+      continue; // reported by history_expand
     }
-
-    // For each piped command, run command and pipe them together
-    int pipeDes[2];
-    int pipeWrite = 0, pipeRead = 0;
-    for (unsigned cmdIdx = 0; cmdIdx < inputCommands.length; ++cmdIdx) {
-      const bool oddCommand = cmdIdx & 0x01;
-      // Name, arguments, and new pipe for current piped command
-      enum CommandName name = commandNames[cmdIdx];
-      Vector currentCmdArgs = commandArgs[cmdIdx];
-      if (cmdIdx < inputCommands.length - 1) { // create new pipe
-        const int piped = pipe(pipeDes);
-        if (piped == -1) {
-          fprintf(stderr, "Failure creating pipes between commands\n");
-          freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs,
-                         numCmds);
-        }
-        pipeWrite = pipeDes[1];
-      }
-
-      // Execute Internal Command
-      if (name != Unknown) {
-        if (name == Exit) {
-          freeAll(&cwd, &userInput, &inputCommands, NULL, numCmds);
-        }
-        int result = execInternal(name, &currentCmdArgs);
-        if (result != 0) {
-          fprintf(stderr, "Error executing internal command\n");
-          handleErrorMsg(result);
-        }
-      }
-      // Execute System Command
-      else {
-        if (suspendedPids.length || bgPids.length) {
-          printf(
-              "Not allowed to start new command while you have a job active\n");
-        } else {
-          pid_t pid = fork();
-          if (pid == -1) {
-            fprintf(stderr, "Unable to fork process %i\n", getpid());
-            freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs,
-                           numCmds);
-          }
-          // Parent process
-          else if (pid != 0) {
-            // Add child to list of jobs in foreground
-            vector_pushBack(&fgPids, &pid);
-
-            // Close file descriptors for pipe
-            if (inputCommands.length > 1) {
-              if (cmdIdx < inputCommands.length - 1) {
-                close(pipeWrite);
-              }
-              if (oddCommand || cmdIdx == inputCommands.length - 1) {
-                close(pipeRead);
-              }
-            }
-
-            pipeRead = pipeDes[0]; // update read end of pipe for next cmd
-          }
-          // Child process
-          else {
-            // Register default signal handler
-            const __sighandler_t registered = signal(SIGTSTP, SIG_DFL);
-            if (registered == SIG_ERR) {
-              fprintf(stderr,
-                      "Failure registering handler for SIGTSTP (%i) signal\n",
-                      SIGTSTP);
-              freeAll(&cwd, &userInput, &inputCommands, commandArgs, numCmds);
-              handleExitError(errno);
-            }
-
-            // Setup pipes between commands
-            if (inputCommands.length >= 2) {
-              // connect reading end of pipe to process
-              if (cmdIdx > 0) {
-                const int dupped = dup2(pipeRead, STDIN_FILENO);
-                if (dupped == -1) {
-                  const int err = errno;
-                  fprintf(stderr, "Child %i failed to assign pipe to %s\n",
-                          getpid(), "stdin");
-                  errno = err;
-                  freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs,
-                                 numCmds);
-                }
-                close(pipeRead);
-              }
-              // connect writing end of pipe to process
-              if (cmdIdx < inputCommands.length - 1) {
-                const int dupped = dup2(pipeWrite, STDOUT_FILENO);
-                if (dupped == -1) {
-                  const int err = errno;
-                  fprintf(stderr, "Child %i failed to assign pipe to %s\n",
-                          getpid(), "stdout");
-                  errno = err;
-                  freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs,
-                                 numCmds);
-                }
-                close(pipeWrite);
-              }
-            }
-
-            // Run system command
-            returnCode = execSystem(&currentCmdArgs);
-            errno = returnCode;
-            fprintf(stderr, "Error executing system command\n");
-            freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs,
-                           numCmds);
-            return returnCode;
-          }
-        }
-      }
+    if (!history_add(string_view(&userInput))) {
+      handleErrorMsg(errno); // only the line's history is lost
     }
 
-    // After all commands have been forked and executed, wait each of them to
-    // finish or get stopped Wait for last child to finish
-    if (fgPids.length > 0) {
-      const bool waited = waitForForegroundPids();
-      if (!waited) { // errno set by waitForForegroundPids
-        fprintf(stderr, "Failed to wait for foreground PIDs\n");
-        freeAllAndExit(&cwd, &userInput, &inputCommands, commandArgs, numCmds);
+    // Parse the command line into pipelines, each with its commands,
+    // arguments and redirections. Syntax errors are reported by syntax_parse
+    Script script;
+    if (syntax_parse(string_view(&userInput), &lineArena, &script)) {
+      // Run each pipeline, as a job where it has system commands
+      const bool executed = execute_script(&script);
+      if (!executed) { // errno set by execute_script
+        fprintf(stderr, "Failure running command line\n");
+        handleExitError(errno);
       }
+    } else if (errno != EINVAL) {
+      fprintf(stderr, "Failure parsing command line\n");
+      handleExitError(errno);
     }
 
-    freeAll((String *)NULL, (String *)NULL, &inputCommands, commandArgs,
-            numCmds);
+    // release the whole parsed command line at once
+    arena_reset(&lineArena);
   }
   return returnCode;
 }
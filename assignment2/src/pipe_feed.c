@@ -0,0 +1,147 @@
+/**
+ * @file pipe_feed.c
+ * @author Justen Di Ruscio
+ * @brief Output of internal commands fed into the pipe to the next command of
+ * their pipeline, without forking a process to run them. Output is written to
+ * a memory file, then spliced into the pipe, moving its pages rather than
+ * copying them through myshell.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _GNU_SOURCE // memfd_create, splice, F_SETPIPE_SZ
+
+#include <myshell/pipe_feed.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Grows the pipe of feed to hold the rest of its output, if it's
+ * allowed to grow that far. Failing to grow it only means feeding it in parts
+ *
+ */
+static void growPipe(const PipeFeed *const feed) {
+  const off_t remaining = feed->length - feed->offset;
+  const int capacity = fcntl(feed->pipeFd, F_GETPIPE_SZ);
+  if (capacity != -1 && remaining > capacity && remaining <= INT_MAX) {
+    fcntl(feed->pipeFd, F_SETPIPE_SZ, (int)remaining);
+  }
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+PipeFeed pipeFeed_constructEmpty(void) {
+  return (PipeFeed){
+      .source = -1, .pipeFd = -1, .offset = 0, .length = 0, .stalled = 0};
+}
+
+bool pipeFeed_construct(PipeFeed *const feed, const int pipeFd) {
+  const char fooName[] = "pipeFeed_construct";
+
+  // Argument Validity Check
+  errno = 0;
+  if (feed == (PipeFeed *)NULL) {
+    fprintf(stderr, "argument 'feed' of %s must point to a valid address\n",
+            fooName);
+    close(pipeFd);
+    errno = EPERM;
+    return false;
+  }
+
+  *feed = pipeFeed_constructEmpty();
+  feed->pipeFd = pipeFd;
+  feed->source = memfd_create("myshell-output", MFD_CLOEXEC);
+  if (feed->source == -1) {
+    fprintf(stderr, "Failure creating memory file for output in %s\n",
+            fooName);
+    const int createErr = errno;
+    pipeFeed_freeData(feed);
+    errno = createErr;
+    return false; // errno set by memfd_create
+  }
+  return true;
+}
+
+bool pipeFeed_feed(PipeFeed *const feed, const bool block) {
+  const char fooName[] = "pipeFeed_feed";
+
+  // Argument Validity Check
+  errno = 0;
+  if (feed == (PipeFeed *)NULL) {
+    fprintf(stderr, "argument 'feed' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (feed->source == -1 || feed->pipeFd == -1) {
+    return true; // nothing to feed
+  }
+
+  // Output written so far, through any descriptor sharing source's offset
+  const off_t length = lseek(feed->source, 0, SEEK_END);
+  if (length == -1) {
+    return false; // errno set by lseek
+  }
+  feed->length = length;
+  growPipe(feed);
+
+  // Move the output's pages into the pipe. Feeding what's left once the pipe
+  // was filled counts as stalled
+  const unsigned flags = SPLICE_F_MOVE | (block ? 0 : SPLICE_F_NONBLOCK);
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  while (feed->offset < feed->length) {
+    loff_t offset = feed->offset;
+    const ssize_t spliced =
+        splice(feed->source, &offset, feed->pipeFd, (loff_t *)NULL,
+               (size_t)(feed->length - feed->offset), flags);
+    if (spliced > 0) {
+      feed->offset = offset;
+    } else if (spliced == 0) {
+      break; // source ended early, having been truncated
+    } else if (spliced == -1 && errno == EINTR) {
+      continue;
+    } else if (spliced == -1 && errno == EAGAIN && !block) {
+      break; // pipe is full; the rest is fed later
+    } else if (spliced == -1 && errno == EPIPE) {
+      feed->offset = feed->length; // reader is gone
+    } else {
+      fprintf(stderr, "Failure feeding output into pipe in %s\n", fooName);
+      return false; // errno set by splice
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  if (block) {
+    feed->stalled += (double)(end.tv_sec - start.tv_sec) +
+                     (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+  }
+  errno = 0;
+  return true;
+}
+
+bool pipeFeed_done(const PipeFeed *const feed) {
+  return feed == (PipeFeed *)NULL || feed->offset >= feed->length;
+}
+
+void pipeFeed_freeData(PipeFeed *const feed) {
+  if (feed == (PipeFeed *)NULL) {
+    return;
+  }
+  if (feed->source != -1) {
+    close(feed->source);
+  }
+  if (feed->pipeFd != -1) {
+    close(feed->pipeFd);
+  }
+  feed->source = -1;
+  feed->pipeFd = -1;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file pipes.c
+ * @author Justen Di Ruscio
+ * @brief Pipes between the commands of pipelines, sized by a setting of
+ * myshell, and stats of the pipelines recently run through them to tune it
+ * with. Larger pipes let each command move more data per context switch.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _GNU_SOURCE // pipe2, F_SETPIPE_SZ
+
+#include <myshell/pipes.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// bytes each pipe is created to hold, or 0 for the kernel's default
+static size_t pipeSize = 0;
+
+// stats of the most recent pipelines, kept in a ring; the most recent is at
+// newest, and entries not recorded yet have no command
+static PipelineStats kept[PIPES_STATS_KEPT];
+static size_t newest = PIPES_STATS_KEPT - 1;
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Frees the data of stats, leaving it unrecorded
+ *
+ */
+static void freeStats(PipelineStats *const stats) {
+  free(stats->command);
+  free(stats->stages);
+  *stats = (PipelineStats){.command = NULL, .stages = NULL};
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+void pipes_setSize(const size_t size) { pipeSize = size; }
+
+size_t pipes_size(void) { return pipeSize; }
+
+bool pipes_create(int pipeDes[2], size_t *const capacity) {
+  const char fooName[] = "pipes_create";
+
+  // Argument Validity Check
+  errno = 0;
+  if (pipeDes == (int *)NULL || capacity == (size_t *)NULL) {
+    fprintf(stderr, "arguments of %s must point to valid addresses\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  if (pipe2(pipeDes, O_CLOEXEC) == -1) {
+    return false; // errno set by pipe2
+  }
+
+  // Size the pipe; past the kernel's limit for unprivileged users it's left
+  // as it is
+  if (pipeSize != 0) {
+    fcntl(pipeDes[1], F_SETPIPE_SZ,
+          pipeSize > INT_MAX ? INT_MAX : (int)pipeSize);
+  }
+  const int granted = fcntl(pipeDes[1], F_GETPIPE_SZ);
+  *capacity = granted != -1 ? (size_t)granted : 0;
+  errno = 0;
+  return true;
+}
+
+void pipes_record(const Job *const job) {
+  if (job == (Job *)NULL) {
+    return;
+  }
+
+  // Copy the job's stats over the least recent pipeline's
+  PipelineStats stats = {.jobId = job->id,
+                         .command = strdup(job->command),
+                         .pipeCapacity = job->pipeCapacity,
+                         .bytesFed = job->bytesFed,
+                         .feedStall = job->feedStall,
+                         .numStages = job->stages.length,
+                         .stages = malloc(job->stages.length * sizeof(Stage))};
+  if (stats.command == (char *)NULL || stats.stages == (Stage *)NULL) {
+    freeStats(&stats);
+    return; // only the stats are lost
+  }
+  memcpy(stats.stages, job->stages.data, job->stages.length * sizeof(Stage));
+  newest = (newest + 1) % PIPES_STATS_KEPT;
+  freeStats(&kept[newest]);
+  kept[newest] = stats;
+}
+
+const PipelineStats *pipes_stats(const size_t age) {
+  if (age >= PIPES_STATS_KEPT) {
+    return (PipelineStats *)NULL;
+  }
+  const PipelineStats *const stats =
+      &kept[(newest + PIPES_STATS_KEPT - age) % PIPES_STATS_KEPT];
+  return stats->command != (char *)NULL ? stats : (PipelineStats *)NULL;
+}
+
+void pipes_freeData(void) {
+  for (size_t keptIdx = 0; keptIdx < PIPES_STATS_KEPT; ++keptIdx) {
+    freeStats(&kept[keptIdx]);
+  }
+  newest = PIPES_STATS_KEPT - 1;
+}
@@ -19,11 +19,12 @@
 
 #include <jd/string.h>
 #include <myshell/commands/internal/exit.h>
+#include <myshell/reaper.h>
 
 bool ignoreInput = false;
 
-const String defaultStripChars = {
-    .data = ARG_DELIMETER, .length = ARG_DELIMETER_LEN, .capacity = 0};
+const StringView defaultStripChars = {.data = ARG_DELIMETER,
+                                      .length = ARG_DELIMETER_LEN};
 
 void printPrompt(String *const cwd) {
   const char fooName[] = "printPrompt";
@@ -38,7 +39,7 @@ void printPrompt(String *const cwd) {
   // Resolve current working directory
   // populate cwd string with CWD, resizing as needed
   while (true) {
-    const char *path = getcwd(cwd->data, cwd->capacity);
+    const char *path = getcwd(string_data(cwd), cwd->capacity);
     // handle getcwd errors
     if (path == (char *)NULL) { // cwd isn't large enough -> resize
       const bool success = string_reserve(cwd, (1 + cwd->capacity) << 2);
@@ -58,15 +59,15 @@ void printPrompt(String *const cwd) {
     }
 
     // no getcwd error
-    cwd->length = strlen(cwd->data);
+    cwd->length = strlen(string_constData(cwd));
     break;
   }
 
   // Print prompt
-  printf("%s%% ", cwd->data);
+  printf("%s%% ", string_constData(cwd));
 }
 
-bool readInputLine(String *const userInput, const String *stripChars) {
+bool readInputLine(String *const userInput, const StringView *stripChars) {
   const char fooName[] = "readInputLine";
   bool valid = false;
 
@@ -79,37 +80,39 @@ bool readInputLine(String *const userInput, const String *stripChars) {
     return valid;
   }
 
-  if (stripChars == (String *)NULL) {
+  if (stripChars == (StringView *)NULL) {
     stripChars = &defaultStripChars;
   }
 
-  // Read stdin as user input
+  // Read stdin as user input, reaping children that finish meanwhile
   ignoreInput = false;
-  char *read = fgets(userInput->data, userInput->capacity, stdin);
+  if (!reaper_waitForInput()) {
+    fprintf(stderr, "Failure waiting for user input in %s\n", fooName);
+    return valid; // errno set by reaper_waitForInput
+  }
+  char *read = fgets(string_data(userInput), userInput->capacity, stdin);
   if (ignoreInput) { // ignore input on Ctrl+Z
     userInput->length = 0;
-    userInput->data[0] = '\0';
+    string_data(userInput)[0] = '\0';
   } else if (read == NULL) { // end-of-file. Ctrl+D
     // overwrite input with exit command
     const size_t cmdLen = strlen(EXIT_COMMAND_NAME);
-    string_reserve(userInput, cmdLen);
+    if (!string_reserve(userInput, cmdLen + 1)) {
+      fprintf(stderr, "Failure reserving room for exit command in %s\n",
+              fooName);
+      return valid; // errno set by string_reserve
+    }
     userInput->length = cmdLen;
-    strcpy(userInput->data, EXIT_COMMAND_NAME);
+    strcpy(string_data(userInput), EXIT_COMMAND_NAME);
   } else {
-    // overwrite input with stripped version of input
-    userInput->length = strlen(userInput->data);
-    const OptionalString stripped = string_strip(userInput, stripChars);
-    if (!stripped.valid) {
-      fprintf(stderr,
-              "Failure removing unnecessary characters from user input, %s, in "
-              "%s\n",
-              userInput->data, fooName);
-      return valid; // errno set by string_strip
-    }
-    const String strippedInput = stripped.data;
-    userInput->length = strlen(strippedInput.data);
-    strcpy(userInput->data, strippedInput.data);
-    string_freeData(&strippedInput);
+    // overwrite input with stripped version of input, moving it in place
+    char *const input = string_data(userInput);
+    userInput->length = strlen(input);
+    const StringView stripped =
+        stringView_strip(string_view(userInput), *stripChars);
+    memmove(input, stripped.data, stripped.length);
+    input[stripped.length] = '\0';
+    userInput->length = stripped.length;
   }
 
   valid = true;
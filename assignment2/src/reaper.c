@@ -0,0 +1,332 @@
+/**
+ * @file reaper.c
+ * @author Justen Di Ruscio
+ * @brief Reaping of child processes as they change state, in the order they
+ * do so. SIGCHLD is read from a signalfd watched with epoll, so children are
+ * reaped while waiting on foreground children and while waiting for input.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _DEFAULT_SOURCE // wait4
+
+#include <myshell/reaper.h>
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <jd/vector.h>
+#include <myshell/job_table.h>
+#include <myshell/pipes.h>
+#include <myshell/terminal.h>
+#include <myshell/timing.h>
+
+static int signalFd = -1;    // reads SIGCHLD
+static int childEvents = -1; // epoll watching signalFd
+static int inputEvents = -1; // epoll watching signalFd and stdin, on a tty
+
+// char* lines reporting jobs that finished or stopped, until they're printed
+static Vector notifications = {.data = NULL,
+                               .length = 0,
+                               .capacity = 0,
+                               .dataSize = sizeof(char *)};
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Creates an epoll instance watching signalFd, and fd unless it's -1.
+ * Sets errno upon error.
+ *
+ * @return int epoll file descriptor, or -1 upon error
+ */
+static int watchEvents(const int fd) {
+  const int events = epoll_create1(EPOLL_CLOEXEC);
+  if (events == -1) {
+    return events; // errno set by epoll_create1
+  }
+  struct epoll_event event = {.events = EPOLLIN, .data.fd = signalFd};
+  if (epoll_ctl(events, EPOLL_CTL_ADD, signalFd, &event) == -1) {
+    close(events);
+    return -1; // errno set by epoll_ctl
+  }
+  event.data.fd = fd;
+  if (fd != -1 && epoll_ctl(events, EPOLL_CTL_ADD, fd, &event) == -1) {
+    close(events);
+    return -1; // errno set by epoll_ctl
+  }
+  return events;
+}
+
+/**
+ * @brief Waits on events until one of the fds it watches is readable.
+ * Interruptions by signals, like SIGTSTP, return as well. Sets errno upon
+ * error.
+ *
+ * @return int fd which is readable, 0 when interrupted or -1 upon error
+ */
+static int waitForEvent(const int events) {
+  struct epoll_event event;
+  const int ready = epoll_wait(events, &event, 1, -1);
+  if (ready == -1) {
+    if (errno == EINTR) {
+      errno = 0;
+      return 0;
+    }
+    return -1; // errno set by epoll_wait
+  }
+  return event.data.fd;
+}
+
+/**
+ * @brief Queues a line reporting that job is now described by what, like
+ * "Done" or "Stopped", for reaper_printNotifications
+ *
+ */
+static void notify(const Job *const job, const char *const what) {
+  const char format[] = "[%u] %-20s %s\n";
+  const int length = snprintf(NULL, 0, format, job->id, what, job->command);
+  char *const line = malloc(length + 1);
+  if (line == (char *)NULL) {
+    return; // only a report is lost
+  }
+  snprintf(line, length + 1, format, job->id, what, job->command);
+  if (!vector_pushBack(&notifications, &line)) {
+    free(line);
+  }
+}
+
+/**
+ * @brief Reports the processes of job, once it finishes, if it's timed:
+ * right away on stderr in the foreground, or else with the other
+ * notifications
+ *
+ */
+static void reportTimes(const Job *const job) {
+  if (!job->timed) {
+    return;
+  }
+  char *const report = timing_report(job);
+  if (report == (char *)NULL) {
+    return; // only a report is lost
+  }
+  if (job->state == JobForeground) {
+    fputs(report, stderr);
+    free(report);
+  } else if (!vector_pushBack(&notifications, &report)) {
+    free(report);
+  }
+}
+
+/**
+ * @brief Reads the bytes process pid read and wrote, through pipes or
+ * otherwise, from procfs. They're left as they are if procfs can't tell, for
+ * instance once pid is reaped.
+ *
+ */
+static void readProcessIo(const pid_t pid, ProcessUsage *const usage) {
+  char path[32];
+  snprintf(path, sizeof(path), "/proc/%i/io", pid);
+  FILE *const io = fopen(path, "re");
+  if (io == (FILE *)NULL) {
+    return;
+  }
+  unsigned long long bytesRead, bytesWritten;
+  if (fscanf(io, "rchar: %llu wchar: %llu", &bytesRead, &bytesWritten) == 2) {
+    usage->bytesRead = bytesRead;
+    usage->bytesWritten = bytesWritten;
+  }
+  fclose(io);
+}
+
+/**
+ * @brief Updates the job of pid with status, reported by waitpid for pid,
+ * and the resources it used if it exited. Jobs are suspended once every
+ * process left is stopped, and removed once every process is reaped, keeping
+ * their stats and reporting them if they're timed.
+ *
+ */
+static void updateJob(const pid_t pid, const int status,
+                      const ProcessUsage *const usage) {
+  Job *const job = jobTable_processChanged(pid, status, usage);
+  if (job == (Job *)NULL) {
+    return; // not launched by myshell
+  }
+
+  // Exited or killed; reported by how its last process exited
+  if (job->numProcesses == 0) {
+    if (job->state != JobForeground) {
+      char what[32] = "Done";
+      if (WIFEXITED(job->status) && WEXITSTATUS(job->status) != 0) {
+        snprintf(what, sizeof(what), "Exit %i", WEXITSTATUS(job->status));
+      } else if (WIFSIGNALED(job->status)) {
+        snprintf(what, sizeof(what), "Killed by signal %i",
+                 WTERMSIG(job->status));
+      }
+      notify(job, what);
+    }
+    reportTimes(job);
+    pipes_record(job);
+    jobTable_remove(job);
+  }
+  // Stopped, by Ctrl+Z for instance
+  else if (WIFSTOPPED(status) && job->numStopped == job->numProcesses &&
+           job->state != JobSuspended) {
+    if (job->state == JobForeground) {
+      putchar('\n'); // past the ^Z echoed by the terminal
+    }
+    jobTable_setState(job, JobSuspended);
+    notify(job, "Stopped");
+  }
+  // Continued by something other than fg or bg
+  else if (WIFCONTINUED(status) && job->state == JobSuspended) {
+    jobTable_setState(job, JobBackground);
+  }
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+bool reaper_init(void) {
+  const char fooName[] = "reaper_init";
+  errno = 0;
+
+  // Receive SIGCHLD through a file descriptor rather than a handler
+  sigset_t childSignal;
+  sigemptyset(&childSignal);
+  sigaddset(&childSignal, SIGCHLD);
+  if (sigprocmask(SIG_BLOCK, &childSignal, NULL) == -1) {
+    fprintf(stderr, "Failure blocking SIGCHLD (%i) in %s\n", SIGCHLD,
+            fooName);
+    return false; // errno set by sigprocmask
+  }
+  signalFd = signalfd(-1, &childSignal, SFD_NONBLOCK | SFD_CLOEXEC);
+  if (signalFd == -1) {
+    fprintf(stderr, "Failure creating signalfd for SIGCHLD in %s\n", fooName);
+    return false; // errno set by signalfd
+  }
+
+  // Watch for children alone, and for children or input from a terminal
+  childEvents = watchEvents(-1);
+  inputEvents = childEvents != -1 && isatty(STDIN_FILENO)
+                    ? watchEvents(STDIN_FILENO)
+                    : -1;
+  if (childEvents == -1 || (inputEvents == -1 && isatty(STDIN_FILENO))) {
+    fprintf(stderr, "Failure creating epoll instances in %s\n", fooName);
+    return false; // errno set by watchEvents
+  }
+  errno = 0;
+  return true;
+}
+
+bool reaper_reap(void) {
+  const char fooName[] = "reaper_reap";
+
+  // Drain pending SIGCHLDs; one may stand for several children
+  struct signalfd_siginfo info;
+  while (read(signalFd, &info, sizeof(info)) == sizeof(info)) {
+  }
+
+  // Reap every child that changed state, in the order they did so. Each is
+  // found first without reaping it, so the I/O of those that exited can still
+  // be read
+  errno = 0;
+  while (true) {
+    siginfo_t info = {.si_pid = 0};
+    const int options = WNOHANG | WSTOPPED | WCONTINUED;
+    int waited = waitid(P_ALL, 0, &info, options | WEXITED | WNOWAIT);
+    ProcessUsage usage = {.bytesRead = 0, .bytesWritten = 0};
+    const bool exited = info.si_code == CLD_EXITED ||
+                        info.si_code == CLD_KILLED ||
+                        info.si_code == CLD_DUMPED;
+    int status;
+    if (waited == 0 && info.si_pid == 0) {
+      break; // none left that changed state
+    }
+    if (waited == 0) {
+      if (exited && jobTable_findByPid(info.si_pid) != (Job *)NULL) {
+        readProcessIo(info.si_pid, &usage);
+      }
+      waited = wait4(info.si_pid, &status, options, &usage.usage);
+    }
+    if (waited == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == ECHILD) {
+        errno = 0;
+        break; // no children at all
+      }
+      fprintf(stderr, "Parent %i failed to wait for children in %s\n",
+              getpid(), fooName);
+      return false; // errno set by waitid or wait4
+    }
+    if (waited == 0) {
+      break; // changed state again before it was reaped
+    }
+    updateJob(info.si_pid, status, exited ? &usage : (ProcessUsage *)NULL);
+  }
+  return true;
+}
+
+bool reaper_waitForeground(const unsigned jobId) {
+  const char fooName[] = "reaper_waitForeground";
+
+  errno = 0;
+  Job *job = jobTable_find(jobId);
+  if (!terminal_give(job)) {
+    return false; // errno set by terminal_give
+  }
+  while (true) {
+    if (!reaper_reap()) {
+      terminal_reclaim(jobTable_find(jobId));
+      return false; // errno set by reaper_reap
+    }
+    job = jobTable_find(jobId);
+    if (job == (Job *)NULL || job->state != JobForeground) {
+      return terminal_reclaim(job); // errno set by terminal_reclaim
+    }
+    if (waitForEvent(childEvents) == -1) {
+      fprintf(stderr, "Failure waiting for children in %s\n", fooName);
+      terminal_reclaim(job);
+      return false; // errno set by waitForEvent
+    }
+  }
+}
+
+bool reaper_waitForInput(void) {
+  const char fooName[] = "reaper_waitForInput";
+
+  errno = 0;
+  while (true) {
+    if (!reaper_reap()) {
+      return false; // errno set by reaper_reap
+    }
+    if (inputEvents == -1) {
+      return true; // not a terminal; input may be buffered already
+    }
+    const int readable = waitForEvent(inputEvents);
+    if (readable == -1) {
+      fprintf(stderr, "Failure waiting for input in %s\n", fooName);
+      return false; // errno set by waitForEvent
+    }
+    if (readable == STDIN_FILENO) {
+      return true;
+    }
+  }
+}
+
+void reaper_printNotifications(void) {
+  reaper_reap(); // errors are reported once waiting instead
+  for (size_t nIdx = 0; nIdx < notifications.length; ++nIdx) {
+    char *const line = *(char **)vector_atUnchecked(&notifications, nIdx);
+    fputs(line, stdout);
+    free(line);
+  }
+  vector_clear(&notifications);
+}
@@ -0,0 +1,186 @@
+/**
+ * @file redirect.c
+ * @author Justen Di Ruscio
+ * @brief Descriptors of a command, arranged from the pipes on either side of
+ * it and its redirections. System commands have them arranged in the child;
+ * internal commands have them arranged in myshell while they run, then
+ * restored.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <myshell/redirect.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// least descriptor copies of myshell's replaced descriptors are moved to,
+// clear of those commonly redirected
+#define SAVED_FD_MIN 10
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Flags to open the file of redirection with
+ *
+ */
+static int openFlags(const Redirection *const redirection) {
+  switch (redirection->kind) {
+  case RedirectInput:
+    return O_RDONLY;
+  case RedirectOutput:
+    return O_WRONLY | O_CREAT | O_TRUNC;
+  default:
+    return O_WRONLY | O_CREAT | O_APPEND;
+  }
+}
+
+/**
+ * @brief Whether fd is already saved
+ *
+ */
+static bool isSaved(const SavedFd *const saved, const size_t numSaved,
+                    const int fd) {
+  for (size_t savedIdx = 0; savedIdx < numSaved; ++savedIdx) {
+    if (saved[savedIdx].fd == fd) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+bool redirect_arrange(const Command *const command, const int stdinFd,
+                      const int stdoutFd, LaunchFd *const fds,
+                      size_t *const numFds, int *const opened) {
+  const char fooName[] = "redirect_arrange";
+
+  // Argument Validity Check
+  errno = 0;
+  if (command == (Command *)NULL || fds == (LaunchFd *)NULL ||
+      numFds == (size_t *)NULL || opened == (int *)NULL) {
+    fprintf(stderr, "arguments of %s must point to valid addresses\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Pipes on either side, which redirections may then replace
+  size_t arranged = 0;
+  if (stdinFd != -1) {
+    fds[arranged++] = (LaunchFd){.fd = STDIN_FILENO, .source = stdinFd};
+  }
+  if (stdoutFd != -1) {
+    fds[arranged++] = (LaunchFd){.fd = STDOUT_FILENO, .source = stdoutFd};
+  }
+
+  // Redirections, in order
+  const size_t numRedirections = command->redirections.length;
+  for (size_t rIdx = 0; rIdx < numRedirections; ++rIdx) {
+    opened[rIdx] = -1;
+  }
+  for (size_t rIdx = 0; rIdx < numRedirections; ++rIdx) {
+    const Redirection *const redirection =
+        (Redirection *)vector_atUnchecked(&command->redirections, rIdx);
+    LaunchFd *const launchFd = &fds[arranged++];
+    launchFd->fd = redirection->fd;
+    if (redirection->kind == RedirectDuplicate) {
+      launchFd->source = redirection->source;
+    } else if (redirection->kind == RedirectClose) {
+      launchFd->source = -1;
+    } else {
+      const char *const path = string_constData(&redirection->path);
+      opened[rIdx] = open(path, openFlags(redirection) | O_CLOEXEC, 0666);
+      if (opened[rIdx] == -1) {
+        const int openErr = errno;
+        fprintf(stderr, "%s: %s\n", path, strerror(openErr));
+        redirect_close(opened, rIdx);
+        errno = openErr;
+        return false; // errno set by open
+      }
+      launchFd->source = opened[rIdx];
+    }
+  }
+  *numFds = arranged;
+  return true;
+}
+
+void redirect_close(const int *const opened, const size_t numOpened) {
+  for (size_t openedIdx = 0; openedIdx < numOpened; ++openedIdx) {
+    if (opened[openedIdx] != -1) {
+      close(opened[openedIdx]);
+    }
+  }
+}
+
+bool redirect_apply(const LaunchFd *const fds, const size_t numFds,
+                    SavedFd *const saved, size_t *const numSaved) {
+  const char fooName[] = "redirect_apply";
+
+  // Argument Validity Check
+  errno = 0;
+  if ((fds == (LaunchFd *)NULL && numFds != 0) || saved == (SavedFd *)NULL ||
+      numSaved == (size_t *)NULL) {
+    fprintf(stderr, "arguments of %s must point to valid addresses\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  fflush(stdout);
+  fflush(stderr);
+  *numSaved = 0;
+  for (size_t fdIdx = 0; fdIdx < numFds; ++fdIdx) {
+    const LaunchFd *const launchFd = &fds[fdIdx];
+
+    // Save the descriptor before its first replacement
+    if (!isSaved(saved, *numSaved, launchFd->fd)) {
+      const int copy = fcntl(launchFd->fd, F_DUPFD_CLOEXEC, SAVED_FD_MIN);
+      if (copy == -1 && errno != EBADF) {
+        const int saveErr = errno;
+        redirect_restore(saved, *numSaved);
+        errno = saveErr;
+        return false; // errno set by fcntl
+      }
+      saved[(*numSaved)++] = (SavedFd){.fd = launchFd->fd, .copy = copy};
+    }
+
+    // Replace it; a descriptor copied onto itself is left as it is
+    int replaced = 0;
+    if (launchFd->source == -1) {
+      replaced = close(launchFd->fd) == 0 || errno == EBADF ? 0 : -1;
+    } else if (launchFd->source != launchFd->fd) {
+      replaced = dup2(launchFd->source, launchFd->fd);
+    }
+    if (replaced == -1) {
+      const int replaceErr = errno;
+      fprintf(stderr, "%i: %s\n", launchFd->source, strerror(replaceErr));
+      redirect_restore(saved, *numSaved);
+      errno = replaceErr;
+      return false; // errno set by close or dup2
+    }
+  }
+  errno = 0;
+  return true;
+}
+
+void redirect_restore(const SavedFd *const saved, const size_t numSaved) {
+  fflush(stdout);
+  fflush(stderr);
+  for (size_t savedIdx = numSaved; savedIdx > 0; --savedIdx) {
+    const SavedFd *const savedFd = &saved[savedIdx - 1];
+    if (savedFd->copy == -1) {
+      close(savedFd->fd);
+    } else {
+      dup2(savedFd->copy, savedFd->fd);
+      close(savedFd->copy);
+    }
+  }
+}
@@ -0,0 +1,211 @@
+/**
+ * @file script_cache.c
+ * @author Justen Di Ruscio
+ * @brief Cache of the scripts myshell has parsed, keyed by path, so scripts
+ * run again are executed from their syntax trees without being read or
+ * parsed. A script is parsed again once its file changes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <myshell/script_cache.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <jd/hashmap.h>
+
+/**
+ * @brief A parsed script, with the identity of the file it was parsed from.
+ * script is its first member, so acquired scripts convert back to it.
+ *
+ */
+typedef struct CachedScript {
+  Script script;
+  Arena arena;       // holds the script's text and syntax tree
+  char *path;        // key of the cache
+  dev_t device;      // device of the file, along with
+  ino_t inode;       // its inode, identifies the file at path
+  off_t size;        // size of the file when read
+  struct timespec modified; // modification time of the file when read
+  unsigned users;    // acquisitions not released yet
+} CachedScript;
+
+HASHMAP_DECLARE_TYPED(ScriptMap, scriptMap, const char *, CachedScript *,
+                      hashMap_hashCString, hashMap_equalsCString)
+
+// constructed on first use
+static ScriptMap scripts;
+static bool scriptsConstructed = false;
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Whether cached was parsed from the file described by info, as it is
+ *
+ */
+static bool isCurrent(const CachedScript *const cached,
+                      const struct stat *const info) {
+  return cached->device == info->st_dev && cached->inode == info->st_ino &&
+         cached->size == info->st_size &&
+         cached->modified.tv_sec == info->st_mtim.tv_sec &&
+         cached->modified.tv_nsec == info->st_mtim.tv_nsec;
+}
+
+/**
+ * @brief Reads the file open at fd, described by info, into cached's arena
+ * and parses it. Sets errno upon error.
+ *
+ * @return true successfully read and parsed the file
+ * @return false failed to read the file, or it has a syntax error
+ */
+static bool parseFile(CachedScript *const cached, const int fd,
+                      const struct stat *const info) {
+  const char fooName[] = "parseFile";
+  arena_reset(&cached->arena);
+
+  // Read the whole file, which is parsed in place
+  const size_t size = info->st_size;
+  char *const text = arena_alloc(&cached->arena, size + 1);
+  if (text == (char *)NULL) {
+    return false; // errno set by arena_alloc
+  }
+  size_t length = 0;
+  while (length < size) {
+    const ssize_t numRead = read(fd, text + length, size - length);
+    if (numRead == -1 && errno == EINTR) {
+      continue;
+    }
+    if (numRead == -1) {
+      fprintf(stderr, "Failure reading script %s in %s\n", cached->path,
+              fooName);
+      return false; // errno set by read
+    }
+    if (numRead == 0) {
+      break; // truncated since
+    }
+    length += numRead;
+  }
+  text[length] = '\0';
+
+  // Parse it, identifying the file it's from
+  const StringView view = {.data = text, .length = length};
+  if (!syntax_parse(view, &cached->arena, &cached->script)) {
+    fprintf(stderr, "Failure parsing script %s in %s\n", cached->path,
+            fooName);
+    return false; // errno set by syntax_parse
+  }
+  cached->device = info->st_dev;
+  cached->inode = info->st_ino;
+  cached->size = info->st_size;
+  cached->modified = info->st_mtim;
+  return true;
+}
+
+/**
+ * @brief Frees cached, once it's out of the cache
+ *
+ */
+static void freeCached(CachedScript *const cached) {
+  arena_freeData(&cached->arena);
+  free(cached->path);
+  free(cached);
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+const Script *scriptCache_acquire(const char *const path) {
+  const char fooName[] = "scriptCache_acquire";
+
+  // Argument Validity Check
+  errno = 0;
+  if (path == (char *)NULL) {
+    fprintf(stderr, "argument 'path' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return (Script *)NULL;
+  }
+  if (!scriptsConstructed) {
+    scripts = scriptMap_constructEmpty();
+    scriptsConstructed = true;
+  }
+
+  // Identify the file at path, as it is now
+  const int fd = open(path, O_RDONLY | O_CLOEXEC);
+  struct stat info;
+  if (fd == -1 || fstat(fd, &info) == -1) {
+    fprintf(stderr, "%s: %s\n", path, strerror(errno));
+    if (fd != -1) {
+      close(fd);
+    }
+    return (Script *)NULL; // errno set by open or fstat
+  }
+
+  // Found in cache, unchanged or still running
+  CachedScript **const found = scriptMap_find(&scripts, path);
+  CachedScript *cached = found != (CachedScript **)NULL ? *found : NULL;
+  if (cached != (CachedScript *)NULL &&
+      (cached->users != 0 || isCurrent(cached, &info))) {
+    close(fd);
+    ++cached->users;
+    return &cached->script;
+  }
+
+  // Otherwise parse it, into the cached script it replaces if any
+  if (cached == (CachedScript *)NULL) {
+    cached = malloc(sizeof(CachedScript));
+    char *const key = strdup(path);
+    if (cached == (CachedScript *)NULL || key == (char *)NULL) {
+      free(cached);
+      free(key);
+      close(fd);
+      return (Script *)NULL; // errno set by malloc or strdup
+    }
+    *cached = (CachedScript){.arena = arena_construct(1 << 12),
+                             .path = key,
+                             .users = 0};
+    if (!scriptMap_insert(&scripts, key, cached)) {
+      freeCached(cached);
+      close(fd);
+      return (Script *)NULL; // errno set by scriptMap_insert
+    }
+  }
+  const bool parsed = parseFile(cached, fd, &info);
+  const int err = errno;
+  close(fd);
+  if (!parsed) {
+    scriptMap_erase(&scripts, cached->path);
+    freeCached(cached);
+    errno = err;
+    return (Script *)NULL; // errno set by parseFile
+  }
+  ++cached->users;
+  return &cached->script;
+}
+
+void scriptCache_release(const Script *const script) {
+  if (script != (Script *)NULL) {
+    --((CachedScript *)script)->users;
+  }
+}
+
+void scriptCache_freeData(void) {
+  if (!scriptsConstructed) {
+    return;
+  }
+  const HashMap *const map = &scripts.map;
+  for (size_t slot = hashMap_nextSlot(map, 0); slot < map->capacity;
+       slot = hashMap_nextSlot(map, slot + 1)) {
+    freeCached(*(CachedScript **)hashMap_valueAt(map, slot));
+  }
+  scriptMap_freeData(&scripts);
+  scriptsConstructed = false;
+}
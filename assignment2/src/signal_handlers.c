@@ -17,26 +17,21 @@
 
 #include <jd/error.h>
 #include <jd/string.h>
-#include <myshell/job_states.h>
+#include <myshell/job_table.h>
 
 extern bool ignoreInput;
 
 /**
- * @brief Prints information regarding suspending processes. Updates job state
- * tracking. Exits the program upon failure.
+ * @brief Prints information regarding suspending processes. Jobs are in their
+ * own process groups, so stopping them is left to the terminal; myshell only
+ * receives SIGTSTP while it holds the terminal itself, at the prompt.
  *
  */
 static void handleSigTStop() {
   // Handle Signal
-  if (fgPids.length == 0 && bgPids.length == 0) {
+  if (jobTable_count(JobForeground) == 0) {
     printf("\nNo job to suspend\n");
     ignoreInput = true;
-  } else { // child process running
-    if (bgPids.length != 0) {
-      ignoreInput = true;
-      vector_assign(&suspendedPids, &bgPids);
-      vector_clear(&bgPids);
-    }
   }
 }
 
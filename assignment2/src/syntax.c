@@ -0,0 +1,546 @@
+/**
+ * @file syntax.c
+ * @author Justen Di Ruscio
+ * @brief Syntax tree of command lines and scripts, and the parser building it
+ * from text. A script is a sequence of pipelines separated by newlines, ';' or
+ * '&', and each pipeline is a sequence of commands separated by '|', with
+ * their arguments and redirections. Redirections are <, >, >>, <& and >&,
+ * each optionally preceded by the descriptor they redirect, like 2>&1. Words
+ * may be quoted with '' or "", or escaped with \, and '#' starts a comment.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <myshell/syntax.h>
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// digits of the most descriptor a redirection may name
+#define MAX_FD_DIGITS 4
+
+/**
+ * @brief Kinds of tokens of the shell language
+ *
+ */
+typedef enum TokenKind {
+  TokenWord,
+  TokenIoNumber,   // digits just before a redirection, like the 2 of 2>&1
+  TokenPipe,       // |
+  TokenSemicolon,  // ;
+  TokenNewline,    // \n
+  TokenBackground, // &
+  TokenLess,       // <
+  TokenGreat,      // >
+  TokenDGreat,     // >>
+  TokenLessAnd,    // <&
+  TokenGreatAnd,   // >&
+  TokenEnd         // end of text
+} TokenKind;
+
+/**
+ * @brief A token, as written in the text
+ *
+ */
+typedef struct Token {
+  TokenKind kind;
+  StringView raw; // text of the token, including quotes
+  bool quoted;    // word has quotes or escapes to remove
+  unsigned line;  // line the token starts on, from 1
+} Token;
+
+/**
+ * @brief State of parsing text, one token ahead
+ *
+ */
+typedef struct Parser {
+  StringView text;
+  size_t pos;       // offset in text of the next token
+  unsigned line;    // line of pos, from 1
+  Token token;      // current token
+  size_t parsedEnd; // offset in text just past the last token consumed
+  Arena *arena;
+} Parser;
+
+// ==================== PRIVATE FUNCTIONS ===============
+static bool isBlank(const char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+static bool isOperator(const char c) {
+  return c == '|' || c == ';' || c == '&' || c == '<' || c == '>' || c == '\n';
+}
+
+/**
+ * @brief Whether token is keyword, unquoted
+ *
+ */
+static bool isKeyword(const Token *const token, const char *const keyword) {
+  const size_t length = strlen(keyword);
+  return token->kind == TokenWord && !token->quoted &&
+         token->raw.length == length &&
+         memcmp(token->raw.data, keyword, length) == 0;
+}
+
+/**
+ * @brief Constructs an empty Vector allocating from arena
+ *
+ */
+static Vector arenaVector(const size_t dataSize, Arena *const arena) {
+  Vector vec = vector_constructEmpty(dataSize);
+  vec.arena = arena;
+  return vec;
+}
+
+/**
+ * @brief Reports a syntax error at the current token. Sets errno to EINVAL.
+ *
+ */
+static bool syntaxError(const Parser *const parser, const char *const reason) {
+  const Token *const token = &parser->token;
+  if (token->kind == TokenEnd) {
+    fprintf(stderr, "Syntax error on line %u: %s at end of input\n",
+            token->line, reason);
+  } else if (token->kind == TokenNewline) {
+    fprintf(stderr, "Syntax error on line %u: %s at end of line\n",
+            token->line, reason);
+  } else {
+    fprintf(stderr, "Syntax error on line %u: %s near '%.*s'\n", token->line,
+            reason, (int)token->raw.length, token->raw.data);
+  }
+  errno = EINVAL;
+  return false;
+}
+
+/**
+ * @brief Scans the word starting at the parser's position, up to an unquoted
+ * blank or operator. Sets errno to EINVAL upon unterminated quotes.
+ *
+ * @return true successfully scanned word
+ * @return false word has unterminated quotes
+ */
+static bool scanWord(Parser *const parser, Token *const token) {
+  const char *const text = parser->text.data;
+  const size_t length = parser->text.length;
+  size_t pos = parser->pos;
+  token->kind = TokenWord;
+  token->quoted = false;
+
+  while (pos < length && !isBlank(text[pos]) && !isOperator(text[pos])) {
+    const char c = text[pos++];
+    if (c == '\\') {
+      token->quoted = true;
+      if (pos < length) {
+        parser->line += text[pos] == '\n';
+        ++pos;
+      }
+    } else if (c == '\'' || c == '"') {
+      token->quoted = true;
+      while (pos < length && text[pos] != c) {
+        if (c == '"' && text[pos] == '\\' && pos + 1 < length) {
+          ++pos; // escaped char can't close the quotes
+        }
+        parser->line += text[pos] == '\n';
+        ++pos;
+      }
+      if (pos == length) {
+        token->raw = (StringView){.data = text + parser->pos,
+                                  .length = pos - parser->pos};
+        parser->token = *token;
+        return syntaxError(parser, "unterminated quotes");
+      }
+      ++pos; // closing quote
+    }
+  }
+  token->raw = (StringView){.data = text + parser->pos,
+                            .length = pos - parser->pos};
+  parser->pos = pos;
+
+  // Unquoted digits right before a redirection name its descriptor
+  if (!token->quoted && pos < length &&
+      (text[pos] == '<' || text[pos] == '>')) {
+    bool digits = true;
+    for (size_t cIdx = 0; cIdx < token->raw.length; ++cIdx) {
+      digits = digits && isdigit((unsigned char)token->raw.data[cIdx]);
+    }
+    if (digits) {
+      token->kind = TokenIoNumber;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Consumes the current token, scanning the next one. Sets errno upon
+ * error.
+ *
+ * @return true successfully scanned the next token
+ * @return false the next token has a syntax error
+ */
+static bool nextToken(Parser *const parser) {
+  const char *const text = parser->text.data;
+  const size_t length = parser->text.length;
+  if (parser->token.raw.data != (char *)NULL) {
+    parser->parsedEnd = parser->token.raw.data + parser->token.raw.length -
+                        parser->text.data;
+  }
+
+  // Skip blanks, escaped newlines and comments
+  while (parser->pos < length) {
+    const char c = text[parser->pos];
+    if (isBlank(c)) {
+      ++parser->pos;
+    } else if (c == '\\' && parser->pos + 1 < length &&
+               text[parser->pos + 1] == '\n') {
+      parser->pos += 2;
+      ++parser->line;
+    } else if (c == '#') {
+      while (parser->pos < length && text[parser->pos] != '\n') {
+        ++parser->pos;
+      }
+    } else {
+      break;
+    }
+  }
+
+  Token token = {.raw = {.data = text + parser->pos, .length = 1},
+                 .quoted = false,
+                 .line = parser->line};
+  if (parser->pos == length) {
+    token.kind = TokenEnd;
+    token.raw.length = 0;
+    parser->token = token;
+    return true;
+  }
+
+  // Operators, then words
+  switch (text[parser->pos]) {
+  case '|':
+    token.kind = TokenPipe;
+    break;
+  case ';':
+    token.kind = TokenSemicolon;
+    break;
+  case '\n':
+    token.kind = TokenNewline;
+    ++parser->line;
+    break;
+  case '&':
+    token.kind = TokenBackground;
+    break;
+  case '<':
+    token.kind = TokenLess;
+    if (parser->pos + 1 < length && text[parser->pos + 1] == '&') {
+      token.kind = TokenLessAnd;
+      token.raw.length = 2;
+    }
+    break;
+  case '>':
+    token.kind = TokenGreat;
+    if (parser->pos + 1 < length && text[parser->pos + 1] == '>') {
+      token.kind = TokenDGreat;
+      token.raw.length = 2;
+    } else if (parser->pos + 1 < length && text[parser->pos + 1] == '&') {
+      token.kind = TokenGreatAnd;
+      token.raw.length = 2;
+    }
+    break;
+  default:
+    if (!scanWord(parser, &token)) {
+      return false; // errno set by scanWord
+    }
+    parser->token = token;
+    return true;
+  }
+  parser->pos += token.raw.length;
+  parser->token = token;
+  return true;
+}
+
+/**
+ * @brief Constructs the String a word token stands for, with its quotes and
+ * escapes removed, from the parser's arena. Sets errno upon error.
+ *
+ * @return true successfully constructed word
+ * @return false an error occurred
+ */
+static bool wordString(Parser *const parser, String *const word) {
+  const StringView raw = parser->token.raw;
+  OptionalString constructed;
+  if (!parser->token.quoted) {
+    constructed = string_constructViewArena(raw, parser->arena);
+  } else {
+    // Words only shrink once their quotes and escapes are removed
+    char *const chars = arena_alloc(parser->arena, raw.length);
+    if (chars == (char *)NULL) {
+      return false; // errno set by arena_alloc
+    }
+    size_t length = 0;
+    for (size_t pos = 0; pos < raw.length; ++pos) {
+      const char c = raw.data[pos];
+      if (c == '\'') {
+        while (raw.data[++pos] != '\'') {
+          chars[length++] = raw.data[pos];
+        }
+      } else if (c == '"') {
+        while (raw.data[++pos] != '"') {
+          // \ only escapes what's special within "", and escaped newlines
+          // are removed
+          if (raw.data[pos] == '\\' && raw.data[pos + 1] != '\0' &&
+              strchr("\\\"\n", raw.data[pos + 1]) != (char *)NULL) {
+            ++pos;
+            if (raw.data[pos] == '\n') {
+              continue;
+            }
+          }
+          chars[length++] = raw.data[pos];
+        }
+      } else if (c == '\\') {
+        if (pos + 1 < raw.length && raw.data[++pos] != '\n') {
+          chars[length++] = raw.data[pos];
+        }
+      } else {
+        chars[length++] = c;
+      }
+    }
+    const StringView unquoted = {.data = chars, .length = length};
+    constructed = string_constructViewArena(unquoted, parser->arena);
+  }
+  *word = constructed.data;
+  return constructed.valid; // errno set by string_constructViewArena
+}
+
+static bool isRedirection(const TokenKind kind) {
+  return kind == TokenLess || kind == TokenGreat || kind == TokenDGreat ||
+         kind == TokenLessAnd || kind == TokenGreatAnd;
+}
+
+/**
+ * @brief Reads the descriptor written as token, which must be unquoted digits
+ *
+ * @return true token is a descriptor
+ * @return false token isn't a descriptor
+ */
+static bool tokenFd(const Token *const token, int *const fd) {
+  const StringView raw = token->raw;
+  if (token->quoted || raw.length == 0 || raw.length > MAX_FD_DIGITS) {
+    return false;
+  }
+  int parsed = 0;
+  for (size_t cIdx = 0; cIdx < raw.length; ++cIdx) {
+    if (!isdigit((unsigned char)raw.data[cIdx])) {
+      return false;
+    }
+    parsed = parsed * 10 + (raw.data[cIdx] - '0');
+  }
+  *fd = parsed;
+  return true;
+}
+
+/**
+ * @brief Parses a redirection: the descriptor it redirects, if given, its
+ * operator, then the file it opens or the descriptor it copies, which is left
+ * as the current token. Sets errno upon error.
+ *
+ * @return true successfully parsed redirection
+ * @return false redirection has a syntax error, or an error occurred
+ */
+static bool parseRedirection(Parser *const parser, Command *const command) {
+  Redirection redirection = {.fd = -1, .source = -1};
+  if (parser->token.kind == TokenIoNumber) {
+    if (!tokenFd(&parser->token, &redirection.fd)) {
+      return syntaxError(parser, "descriptor out of range");
+    }
+    if (!nextToken(parser)) {
+      return false; // errno set by nextToken
+    }
+  }
+  const TokenKind operation = parser->token.kind;
+  if (redirection.fd == -1) {
+    redirection.fd = operation == TokenLess || operation == TokenLessAnd
+                         ? STDIN_FILENO
+                         : STDOUT_FILENO;
+  }
+  if (!nextToken(parser)) {
+    return false; // errno set by nextToken
+  }
+  const TokenKind target = parser->token.kind;
+  if (target != TokenWord && target != TokenIoNumber) {
+    return syntaxError(parser, "expected a file to redirect to");
+  }
+
+  // Copy or close a descriptor
+  if (operation == TokenLessAnd || operation == TokenGreatAnd) {
+    const StringView raw = parser->token.raw;
+    if (!parser->token.quoted && raw.length == 1 && raw.data[0] == '-') {
+      redirection.kind = RedirectClose;
+    } else if (tokenFd(&parser->token, &redirection.source)) {
+      redirection.kind = RedirectDuplicate;
+    } else {
+      return syntaxError(parser, "expected a descriptor to copy");
+    }
+    redirection.path = string_constructEmpty();
+  }
+  // Open a file
+  else {
+    redirection.kind = operation == TokenLess    ? RedirectInput
+                       : operation == TokenGreat ? RedirectOutput
+                                                 : RedirectAppend;
+    if (!wordString(parser, &redirection.path)) {
+      return false; // errno set by wordString
+    }
+  }
+  if (!vector_pushBack(&command->redirections, &redirection)) {
+    return false; // errno set by vector_pushBack
+  }
+  return true;
+}
+
+/**
+ * @brief Parses a command: words and redirections, up to an operator other
+ * than a redirection. Sets errno upon error.
+ *
+ * @return true successfully parsed command
+ * @return false command has a syntax error, or an error occurred
+ */
+static bool parseCommand(Parser *const parser, Command *const command) {
+  command->args = arenaVector(sizeof(String), parser->arena);
+  command->redirections = arenaVector(sizeof(Redirection), parser->arena);
+
+  while (true) {
+    const TokenKind kind = parser->token.kind;
+    // Argument
+    if (kind == TokenWord) {
+      String arg;
+      if (!wordString(parser, &arg) ||
+          !vector_pushBack(&command->args, &arg)) {
+        return false; // errno set by wordString or vector_pushBack
+      }
+    }
+    // Redirection, followed by its path or descriptor
+    else if (kind == TokenIoNumber || isRedirection(kind)) {
+      if (!parseRedirection(parser, command)) {
+        return false; // errno set by parseRedirection
+      }
+    } else {
+      break;
+    }
+    if (!nextToken(parser)) {
+      return false; // errno set by nextToken
+    }
+  }
+
+  if (command->args.length == 0) {
+    return syntaxError(parser, "expected a command");
+  }
+  command->name = parseCommandName((String *)vector_atUnchecked(
+      &command->args, 0)); // parsed once, however often it's run
+  return true;
+}
+
+/**
+ * @brief Parses a pipeline: commands separated by '|', which may each be
+ * followed by newlines, after an optional time keyword. Sets errno upon
+ * error.
+ *
+ * @return true successfully parsed pipeline
+ * @return false pipeline has a syntax error, or an error occurred
+ */
+static bool parsePipeline(Parser *const parser, Pipeline *const pipeline) {
+  const size_t start = parser->token.raw.data - parser->text.data;
+  pipeline->commands = arenaVector(sizeof(Command), parser->arena);
+  pipeline->background = false;
+  pipeline->timed = false;
+
+  // The time keyword, followed by a command rather than options of the time
+  // builtin
+  while (isKeyword(&parser->token, "time")) {
+    const Parser before = *parser;
+    if (!nextToken(parser)) {
+      return false; // errno set by nextToken
+    }
+    if (parser->token.kind != TokenWord || parser->token.raw.data[0] == '-') {
+      *parser = before;
+      break;
+    }
+    pipeline->timed = true;
+  }
+
+  while (true) {
+    Command command;
+    if (!parseCommand(parser, &command) ||
+        !vector_pushBack(&pipeline->commands, &command)) {
+      return false; // errno set by parseCommand or vector_pushBack
+    }
+    if (parser->token.kind != TokenPipe) {
+      break;
+    }
+    do {
+      if (!nextToken(parser)) {
+        return false; // errno set by nextToken
+      }
+    } while (parser->token.kind == TokenNewline);
+  }
+
+  pipeline->text = (StringView){.data = parser->text.data + start,
+                                .length = parser->parsedEnd - start};
+  return true;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+bool syntax_parse(const StringView text, Arena *const arena,
+                  Script *const script) {
+  const char fooName[] = "syntax_parse";
+
+  // Argument Validity Check
+  errno = 0;
+  if (arena == (Arena *)NULL || script == (Script *)NULL ||
+      (text.data == (char *)NULL && text.length != 0)) {
+    fprintf(stderr, "arguments of %s must point to valid addresses\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  Parser parser = {.text = text,
+                   .pos = 0,
+                   .line = 1,
+                   .token = {.raw = {.data = NULL, .length = 0}},
+                   .parsedEnd = 0,
+                   .arena = arena};
+  script->pipelines = arenaVector(sizeof(Pipeline), arena);
+  if (!nextToken(&parser)) {
+    return false; // errno set by nextToken
+  }
+
+  // Pipelines, each ended by a separator or the end of text
+  while (parser.token.kind != TokenEnd) {
+    if (parser.token.kind == TokenNewline) {
+      if (!nextToken(&parser)) {
+        return false; // errno set by nextToken
+      }
+      continue;
+    }
+    Pipeline pipeline;
+    if (!parsePipeline(&parser, &pipeline)) {
+      return false; // errno set by parsePipeline
+    }
+    const TokenKind separator = parser.token.kind;
+    if (separator != TokenBackground && separator != TokenSemicolon &&
+        separator != TokenNewline && separator != TokenEnd) {
+      return syntaxError(&parser, "unexpected token");
+    }
+    pipeline.background = separator == TokenBackground;
+    if (!vector_pushBack(&script->pipelines, &pipeline)) {
+      return false; // errno set by vector_pushBack
+    }
+    if (separator != TokenEnd && !nextToken(&parser)) {
+      return false; // errno set by nextToken
+    }
+  }
+  return true;
+}
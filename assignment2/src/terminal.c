@@ -0,0 +1,116 @@
+/**
+ * @file terminal.c
+ * @author Justen Di Ruscio
+ * @brief Control of the terminal myshell reads from, handed to the process
+ * group of the job in the foreground and taken back once it stops or exits
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <myshell/terminal.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <termios.h>
+#include <unistd.h>
+
+// copy of the terminal on stdin, so it stays reachable while myshell's stdin
+// is redirected, or -1 when myshell isn't interactive
+static int terminalFd = -1;
+
+// terminal modes of myshell, restored whenever it takes the terminal back
+static struct termios shellModes;
+
+// ==================== PUBLIC FUNCTIONS ===============
+bool terminal_init(void) {
+  const char fooName[] = "terminal_init";
+  errno = 0;
+
+  if (!isatty(STDIN_FILENO)) {
+    errno = 0;
+    return true; // no terminal to control
+  }
+
+  // Wait to be put in the foreground, if launched in the background
+  pid_t shellPgid;
+  while (tcgetpgrp(STDIN_FILENO) != (shellPgid = getpgrp())) {
+    kill(-shellPgid, SIGTTIN);
+  }
+
+  // Jobs, not myshell, are stopped by reading or writing the terminal while
+  // in the background, or by handing it over
+  if (signal(SIGTTIN, SIG_IGN) == SIG_ERR ||
+      signal(SIGTTOU, SIG_IGN) == SIG_ERR) {
+    fprintf(stderr, "Failure ignoring terminal stop signals in %s\n", fooName);
+    return false; // errno set by signal
+  }
+
+  // Lead a process group apart from the jobs' and take the terminal; a
+  // session leader already does
+  if (setpgid(0, 0) == -1 && errno != EPERM) {
+    fprintf(stderr, "Failure putting myshell in its own process group in %s\n",
+            fooName);
+    return false; // errno set by setpgid
+  }
+  if (tcsetpgrp(STDIN_FILENO, getpgrp()) == -1 ||
+      tcgetattr(STDIN_FILENO, &shellModes) == -1) {
+    fprintf(stderr, "Failure taking control of the terminal in %s\n", fooName);
+    return false; // errno set by tcsetpgrp or tcgetattr
+  }
+  terminalFd = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, STDERR_FILENO + 1);
+  if (terminalFd == -1) {
+    fprintf(stderr, "Failure copying the terminal descriptor in %s\n",
+            fooName);
+    return false; // errno set by fcntl
+  }
+  errno = 0;
+  return true;
+}
+
+int terminal_fd(void) { return terminalFd; }
+
+bool terminal_give(Job *const job) {
+  const char fooName[] = "terminal_give";
+  errno = 0;
+
+  if (terminalFd == -1 || job == (Job *)NULL) {
+    return true;
+  }
+  if (tcsetpgrp(terminalFd, job->pgid) == -1) {
+    fprintf(stderr, "Failure handing the terminal to job %u in %s\n", job->id,
+            fooName);
+    return false; // errno set by tcsetpgrp
+  }
+  if (job->hasModes &&
+      tcsetattr(terminalFd, TCSADRAIN, &job->terminalModes) == -1) {
+    fprintf(stderr, "Failure restoring terminal modes of job %u in %s\n",
+            job->id, fooName);
+    return false; // errno set by tcsetattr
+  }
+  return true;
+}
+
+bool terminal_reclaim(Job *const job) {
+  const char fooName[] = "terminal_reclaim";
+  errno = 0;
+
+  if (terminalFd == -1) {
+    return true;
+  }
+  if (job != (Job *)NULL) {
+    job->hasModes = tcgetattr(terminalFd, &job->terminalModes) == 0;
+  }
+  if (tcsetpgrp(terminalFd, getpgrp()) == -1 ||
+      tcsetattr(terminalFd, TCSADRAIN, &shellModes) == -1) {
+    fprintf(stderr, "Failure taking the terminal back in %s\n", fooName);
+    return false; // errno set by tcsetpgrp or tcsetattr
+  }
+  return true;
+}
@@ -0,0 +1,226 @@
+/**
+ * @file timing.c
+ * @author Justen Di Ruscio
+ * @brief Timing of pipelines, started by the time keyword or every pipeline
+ * once set to. Each process of a timed job is reported once the job finishes,
+ * from the resources wait4 returned as it was reaped, so the slow stage of a
+ * pipeline stands out. Pipelines of internal commands alone are reported from
+ * what myshell and the children it reaped used while they ran.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _DEFAULT_SOURCE // open_memstream, timersub
+
+#include <myshell/timing.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// whether every pipeline is timed, as if started by time
+static bool alwaysTimed = false;
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Seconds from start to end
+ *
+ */
+static double elapsed(const struct timespec start, const struct timespec end) {
+  return (double)(end.tv_sec - start.tv_sec) +
+         (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+/**
+ * @brief Seconds of time
+ *
+ */
+static double seconds(const struct timeval time) {
+  return (double)time.tv_sec + (double)time.tv_usec / 1e6;
+}
+
+/**
+ * @brief Usage of used, less the usage of before, except for the peak
+ * memory, which is used's
+ *
+ */
+static struct rusage usageSince(const struct rusage *const before,
+                                const struct rusage *const used) {
+  struct rusage since = *used;
+  timersub(&used->ru_utime, &before->ru_utime, &since.ru_utime);
+  timersub(&used->ru_stime, &before->ru_stime, &since.ru_stime);
+  since.ru_nvcsw = used->ru_nvcsw - before->ru_nvcsw;
+  since.ru_nivcsw = used->ru_nivcsw - before->ru_nivcsw;
+  return since;
+}
+
+/**
+ * @brief Adds the usage of more to total, keeping the greatest peak memory
+ *
+ */
+static void addUsage(struct rusage *const total,
+                     const struct rusage *const more) {
+  timeradd(&total->ru_utime, &more->ru_utime, &total->ru_utime);
+  timeradd(&total->ru_stime, &more->ru_stime, &total->ru_stime);
+  total->ru_nvcsw += more->ru_nvcsw;
+  total->ru_nivcsw += more->ru_nivcsw;
+  if (more->ru_maxrss > total->ru_maxrss) {
+    total->ru_maxrss = more->ru_maxrss;
+  }
+}
+
+/**
+ * @brief Prints the column names of the report
+ *
+ */
+static void printHeader(FILE *const stream) {
+  fprintf(stream, "    %-15s %7s %9s %9s %9s %8s %6s %6s\n", "stage", "pid",
+          "real", "user", "sys", "max rss", "vcsw", "ivcsw");
+}
+
+/**
+ * @brief Prints a line of the report, for the stage named name. Its pid is
+ * left out unless positive, and its real time unless it's known.
+ *
+ */
+static void printRow(FILE *const stream, const char *const name,
+                     const pid_t pid, const double real,
+                     const struct rusage *const usage) {
+  char pidText[16] = "";
+  char realText[16] = "-";
+  char rssText[24]; // widest long, with its sign, suffix and NUL
+  if (pid > 0) {
+    snprintf(pidText, sizeof(pidText), "%i", pid);
+  }
+  if (real >= 0) {
+    snprintf(realText, sizeof(realText), "%.3fs", real);
+  }
+  // ru_maxrss is in kilobytes on Linux
+  const long rss = usage->ru_maxrss;
+  if (rss < 1024) {
+    snprintf(rssText, sizeof(rssText), "%liK", rss);
+  } else if (rss < 1024 * 1024) {
+    snprintf(rssText, sizeof(rssText), "%.1fM", (double)rss / 1024);
+  } else {
+    snprintf(rssText, sizeof(rssText), "%.1fG", (double)rss / (1024 * 1024));
+  }
+  fprintf(stream, "    %-15s %7s %9s %8.3fs %8.3fs %8s %6li %6li\n", name,
+          pidText, realText, seconds(usage->ru_utime),
+          seconds(usage->ru_stime), rssText, usage->ru_nvcsw,
+          usage->ru_nivcsw);
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+void timing_setAlways(const bool always) { alwaysTimed = always; }
+
+bool timing_always(void) { return alwaysTimed; }
+
+char *timing_report(const Job *const job) {
+  const char fooName[] = "timing_report";
+
+  // Argument Validity Check
+  errno = 0;
+  if (job == (Job *)NULL) {
+    fprintf(stderr, "argument 'job' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return (char *)NULL;
+  }
+
+  char *report = (char *)NULL;
+  size_t length = 0;
+  FILE *const stream = open_memstream(&report, &length);
+  if (stream == (FILE *)NULL) {
+    return (char *)NULL; // errno set by open_memstream
+  }
+
+  // A line per process, then the whole pipeline, from the first process
+  // launched to the last reaped
+  fprintf(stream, "[%u] %s\n", job->id, job->command);
+  printHeader(stream);
+  struct rusage total = {.ru_maxrss = 0};
+  struct timespec first = {0, 0}, last = {0, 0};
+  for (size_t stageIdx = 0; stageIdx < job->stages.length; ++stageIdx) {
+    const Stage *const stage =
+        (Stage *)vector_atUnchecked(&job->stages, stageIdx);
+    printRow(stream, stage->name, stage->pid,
+             elapsed(stage->launched, stage->reaped), &stage->usage.usage);
+    addUsage(&total, &stage->usage.usage);
+    if (stageIdx == 0 || elapsed(stage->launched, first) > 0) {
+      first = stage->launched;
+    }
+    if (stageIdx == 0 || elapsed(last, stage->reaped) > 0) {
+      last = stage->reaped;
+    }
+  }
+  if (job->stages.length > 1) {
+    printRow(stream, "total", 0, elapsed(first, last), &total);
+  }
+  if (job->bytesFed != 0) {
+    fprintf(stream,
+            "    %zu bytes fed by internal commands, stalled %.3fs\n",
+            job->bytesFed, job->feedStall);
+  }
+
+  if (fclose(stream) != 0) {
+    free(report);
+    return (char *)NULL; // errno set by fclose
+  }
+  return report;
+}
+
+bool timing_mark(TimingMark *const mark) {
+  const char fooName[] = "timing_mark";
+
+  // Argument Validity Check
+  errno = 0;
+  if (mark == (TimingMark *)NULL) {
+    fprintf(stderr, "argument 'mark' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &mark->start);
+  if (getrusage(RUSAGE_SELF, &mark->self) == -1 ||
+      getrusage(RUSAGE_CHILDREN, &mark->children) == -1) {
+    return false; // errno set by getrusage
+  }
+  return true;
+}
+
+bool timing_printSince(const TimingMark *const mark, const StringView command,
+                       FILE *const stream) {
+  const char fooName[] = "timing_printSince";
+
+  // Argument Validity Check
+  errno = 0;
+  if (mark == (TimingMark *)NULL || stream == (FILE *)NULL) {
+    fprintf(stderr, "arguments of %s must point to valid addresses\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  TimingMark now;
+  if (!timing_mark(&now)) {
+    return false; // errno set by timing_mark
+  }
+  const struct rusage self = usageSince(&mark->self, &now.self);
+  const struct rusage children = usageSince(&mark->children, &now.children);
+  fprintf(stream, "%.*s\n", (int)command.length, command.data);
+  printHeader(stream);
+  printRow(stream, "myshell", getpid(), elapsed(mark->start, now.start),
+           &self);
+  // Only children reaped since the mark count towards their CPU time
+  if (timercmp(&now.children.ru_utime, &mark->children.ru_utime, !=) ||
+      timercmp(&now.children.ru_stime, &mark->children.ru_stime, !=) ||
+      now.children.ru_nvcsw != mark->children.ru_nvcsw) {
+    printRow(stream, "children", 0, -1, &children);
+  }
+  return true;
+}
@@ -80,7 +80,8 @@ int destroyBullet(Bullet* const b);
 int shootBullet(const int row, const int col, const BulletType bType, void* const shooter);
 
 /**
- * @brief Deletes the provided bullet task and the enclosed bullet. Used as a deleter.
+ * @brief Deletes the enclosed bullet and stops the provided bullet task, whose
+ * memory returns to the thread pool once it stops running. Used as a deleter.
  *
  * @param bulletTask Task of shot bullet to delete
  */
@@ -16,11 +16,15 @@
 #include <jd/task.h>
 #include "../distribute/console.h"
 
+// time between screen refreshes; 4 console ticks
+#define REFRESH_PERIOD_MS 40
+
 extern pthread_mutex_t consoleMutex;
 
 // provide to runScreenRefresher
 typedef struct RefreshArg {
   Task* const sleepGame;
+  Task* const refresher; // periodic task running runScreenRefresher
 } RefreshArg;
 
 /**
@@ -39,7 +43,8 @@ bool gameConsoleInit();
 int gameConsoleFinish();
 
 /**
- * @brief thread start function to refresh console
+ * @brief periodic task function to refresh console once. Cancels its task once
+ * the game ends
  *
  * @param data RefreshArg
  * @return void* errno
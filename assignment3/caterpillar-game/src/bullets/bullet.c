@@ -12,6 +12,8 @@
 
 #include <errno.h>
 #include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
 #include <stdio.h>
 
 #include "bullet_list.h"
@@ -22,14 +24,17 @@
 #include <caterpillar/game/game_console.h>
 #include <caterpillar/user/player_state.h>
 
-// contains all the data necessary to shoot a bullet
-// Task must be first
+// contains all the data necessary to shoot a bullet, in a block recycled
+// through the thread pool. Task must be first
 typedef struct ShootBulletData {
   Task runShootTask;
   Bullet b;
   RunShootBulletArg runShootArg;
   void *runShootResult;
+  atomic_bool stopped; // set by deleteBulletTask to end runShootBullet
 } ShootBulletData;
+_Static_assert(sizeof(ShootBulletData) <= TP_TASK_BLOCK_SIZE,
+               "ShootBulletData must fit in a thread pool task block");
 
 // Characters displayed
 #define BULLET_ANIM_TILES 2
@@ -178,8 +183,13 @@ static void *runShootBullet(void *data) {
 
   // Run Shoot Bullet
   else {
-    Task *bulletTask = (*(Task **)arg->shootNode->data);
-    while (!registry.sleepGame->completed && !bulletTask->completed) {
+    // found through arg's block, since shootNode is freed once the bullet is
+    // erased from its shooter's list
+    const ShootBulletData *const shootData =
+        (const ShootBulletData *)((const char *)arg -
+                                  offsetof(ShootBulletData, runShootArg));
+    while (!task_isCompleted(registry.sleepGame) &&
+           !atomic_load(&shootData->stopped)) {
       // Delete bullet if it's off the play area
       const bool playerBulletEnd = arg->bullet->bulletType == b_Player &&
                                    arg->bullet->row == CATERPILLAR_TOP_ROW;
@@ -302,13 +312,13 @@ int shootBullet(const int row, const int col, const BulletType bType,
     return 0;
   }
 
-  // Allocate memory to shoot new bullet
-  void *bulletBytes = malloc(sizeof(ShootBulletData));
-  if (bulletBytes == (void *)NULL) {
+  // Take recycled memory from the thread pool to shoot new bullet
+  Task *const bulletBytes =
+      tp_acquireTask(registry.tp, sizeof(ShootBulletData));
+  if (bulletBytes == (Task *)NULL) {
     fprintf(stderr, "Failure allocating memory to shoot bullet in %s\n",
             fooName);
-    free(bulletBytes);
-    return errno;
+    return errno; // errno set by tp_acquireTask
   }
   ShootBulletData *shootData = (ShootBulletData *)bulletBytes;
 
@@ -324,7 +334,7 @@ int shootBullet(const int row, const int col, const BulletType bType,
             "Unable to allocate memory for new node to contain bullets' task "
             "in %s\n",
             fooName);
-    free(bulletBytes);
+    tp_releaseTask(registry.tp, bulletBytes);
     return errno;
   }
 
@@ -334,20 +344,21 @@ int shootBullet(const int row, const int col, const BulletType bType,
     fprintf(stderr,
             "Failure trying to initialize a new bullet to shoot in %s\n",
             fooName);
-    free(bulletBytes);
+    tp_releaseTask(registry.tp, bulletBytes);
     free(shootNode);
     return errno;
   }
   runShootArg->shootNode = shootNode;
   runShootArg->bullet = bullet;
   runShootArg->shooter = shooter;
+  atomic_init(&shootData->stopped, false);
   errno = task_init(shootTask, runShootBullet, runShootArg, runResult);
   if (errno != 0) {
     fprintf(stderr,
             "Failure trying to initialize task to run spawned caterpillar "
             "in %s\n",
             fooName);
-    free(bulletBytes);
+    tp_releaseTask(registry.tp, bulletBytes);
     free(shootNode);
     return errno;
   }
@@ -358,8 +369,9 @@ int shootBullet(const int row, const int col, const BulletType bType,
     fprintf(stderr,
             "Failed to store shoot bullet task in shooter's list in %s\n",
             fooName);
-    free(bulletBytes);
+    tp_releaseTask(registry.tp, bulletBytes);
     free(shootNode);
+    return errno;
   }
 
   // Shoot bullet on separate thread
@@ -367,7 +379,7 @@ int shootBullet(const int row, const int col, const BulletType bType,
   if (errno != 0) {
     fprintf(stderr, "Failed to run shot bullet on thread pool in %s\n",
             fooName);
-    free(bulletBytes);
+    tp_releaseTask(registry.tp, bulletBytes);
     free(shootNode);
     return errno;
   }
@@ -389,11 +401,13 @@ void deleteBulletTask(void *bulletTask) {
     fprintf(stderr, "Failure to destroy a bullet in %s\n", fooName);
   }
 
-  // destroy the bullet's task
-  task_destroy(bulletTask);
+  // stop the bullet's task, which may not have run yet. It's left for the
+  // thread pool to complete, since it may still hold it
+  ShootBulletData *const shootData = (ShootBulletData *)bt;
+  atomic_store(&shootData->stopped, true);
 
-  // free the bullet's task
-  free(bulletTask);
+  // recycle the bullet's memory once the thread pool is done running it
+  tp_releaseTask(registry.tp, bt);
 }
 
 int deleteBullet(void *const shooter, ListNode *const shootNode,
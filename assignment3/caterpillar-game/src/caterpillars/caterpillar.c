@@ -265,7 +265,8 @@ void *runCaterpillar(void *data) {
   // Run Caterpillar
   else {
     int movesSinceShoot = 0;
-    while (!arg->sleepGame->completed && !arg->runCaterpillarTask->completed) {
+    while (!task_isCompleted(arg->sleepGame) &&
+           !task_isCompleted(arg->runCaterpillarTask)) {
       const int movesBeforeShoot = 1 + rand() % (int)(GAME_COLS / 1.5);
       // Update segments' animation to animate caterpillar
       CaterpillarSegment *const segments = arg->caterpillar->segments;
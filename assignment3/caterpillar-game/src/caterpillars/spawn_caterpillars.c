@@ -40,7 +40,7 @@ const int spawnRateTicks =
 void sleepTicksUntil(const int ticks, const Task *const sleepGame) {
   for (int sleep = CATERPILLAR_INIT_SPEED; sleep <= ticks;
        sleep += CATERPILLAR_INIT_SPEED) {
-    if (sleepGame->completed) {
+    if (task_isCompleted(sleepGame)) {
       return;
     }
     sleepTicks(sleep);
@@ -100,7 +100,7 @@ void *spawnCaterpillars(void *data) {
 
   // Spawn Caterpillars
   else {
-    while (!arg->sleepGame->completed) {
+    while (!task_isCompleted(arg->sleepGame)) {
       // allocate memory to spawn new caterpillar
       const void *const catData_ = malloc(sizeof(CaterpillarData));
       if (errno != 0) {
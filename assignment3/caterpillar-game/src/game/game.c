@@ -89,10 +89,11 @@ void caterpillarRun(ThreadPool *const threadPool) {
       handleExitError(errno);
     }
 
-    // ========== SCREEN REFRESHER THREAD =============
+    // ========== SCREEN REFRESHER PERIODIC TASK =============
     Task screenRefresherTask;
     void *screenRefreshResult;
-    RefreshArg refreshArg = {.sleepGame = &sleepGame};
+    RefreshArg refreshArg = {.sleepGame = &sleepGame,
+                             .refresher = &screenRefresherTask};
     errno = task_init(&screenRefresherTask, runScreenRefresher, &refreshArg,
                       &screenRefreshResult);
     if (errno != 0) {
@@ -104,7 +105,8 @@ void caterpillarRun(ThreadPool *const threadPool) {
       task_destroy(&screenRefresherTask);
       handleExitError(errno);
     }
-    errno = tp_enqueueImmediate(threadPool, &screenRefresherTask);
+    errno = tp_enqueuePeriodic(threadPool, &screenRefresherTask, 0,
+                               REFRESH_PERIOD_MS);
     if (errno != 0) {
       fprintf(stderr, "Unable to add refresher task to threadpool in %s\n",
               fooName);
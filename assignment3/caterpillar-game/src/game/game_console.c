@@ -19,8 +19,6 @@
 #include "../distribute/console.h"
 #include <caterpillar/game/constants.h>
 
-#define REFRESH_SLEEP_TICKS 4
-
 pthread_mutex_t consoleMutex;
 
 // ======================= Public Console Functions ========================
@@ -94,22 +92,29 @@ void *runScreenRefresher(void *data) {
             "main Task used to sleep the game\n",
             fooName);
     errno = EPERM;
+  } else if (arg->refresher == (Task *)NULL) {
+    fprintf(stderr,
+            "member 'refresher' of argument 'data' of %s must point to the "
+            "periodic Task running it\n",
+            fooName);
+    errno = EPERM;
+  }
+
+  // Stop refreshing once the game ends
+  else if (task_isCompleted(arg->sleepGame)) {
+    errno = task_cancel(arg->refresher);
   }
 
   // Draw screen buffer to screen
   else {
-    while (!arg->sleepGame->completed) {
-      // hold lock to prevent tearing on screen
-      errno = pthread_mutex_lock(&consoleMutex);
-      if (errno != 0) {
-        fprintf(
-            stderr,
-            "Error encountered while trying to obtain lock to refresh screen "
-            "in %s\n",
-            fooName);
-        break;
-      }
-
+    // hold lock to prevent tearing on screen
+    errno = pthread_mutex_lock(&consoleMutex);
+    if (errno != 0) {
+      fprintf(stderr,
+              "Error encountered while trying to obtain lock to refresh screen "
+              "in %s\n",
+              fooName);
+    } else {
       consoleRefresh();
 
       errno = pthread_mutex_unlock(&consoleMutex);
@@ -119,14 +124,15 @@ void *runScreenRefresher(void *data) {
             "Error encountered while trying to release lock after refreshing "
             "screen in %s\n",
             fooName);
-        break;
       }
-      sleepTicks(REFRESH_SLEEP_TICKS);
     }
   }
 
-  // Stop game if error occurred
-  if (errno != 0) {
+  // Stop game and refreshing if error occurred
+  if (errno != 0 && arg != (RefreshArg *)NULL) {
+    if (arg->refresher != (Task *)NULL) {
+      task_cancel(arg->refresher);
+    }
     const int err = task_markCompleted(arg->sleepGame);
     if (err != 0) {
       fprintf(stderr, "Error while trying to mark game as completed in %s\n",
@@ -9,6 +9,8 @@
 #include <caterpillar/game/game.h>
 
 #define NUM_INIT_THREADS 16
+#define MAX_THREADS 128           // bullets beyond this wait for a thread
+#define IDLE_THREAD_TIMEOUT_MS 2000 // reap threads left over from bursts
 #define INSTRUCTIONS_SLEEP_TICKS 150
 
 void printInstructions() {
@@ -26,7 +28,13 @@ void printInstructions() {
 int main() {
   srand(time(0));
   ThreadPool tp;
-  tp_init(&tp, NUM_INIT_THREADS);
+  ThreadPoolConfig tpConfig = tp_defaultConfig();
+  tpConfig.numInitThreads = NUM_INIT_THREADS;
+  tpConfig.minThreads = NUM_INIT_THREADS;
+  tpConfig.maxThreads = MAX_THREADS;
+  tpConfig.idleTimeoutMs = IDLE_THREAD_TIMEOUT_MS;
+  tpConfig.mode = tp_WorkStealing; // bullets shot from caterpillars stay local
+  tp_initConfig(&tp, &tpConfig);
 
   printInstructions();
   sleepTicks(INSTRUCTIONS_SLEEP_TICKS);
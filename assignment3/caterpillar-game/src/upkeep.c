@@ -114,7 +114,7 @@ void *runUpkeep(void *data) {
 
   // Upkeep game
   else {
-    while (!arg->sleepGame->completed) {
+    while (!task_isCompleted(arg->sleepGame)) {
       // Draw images to curses screen buffer
       errno = pthread_mutex_lock(&consoleMutex);
       if (errno != 0) {
@@ -299,7 +299,7 @@ void *runPlayer(void *data) {
 
   // Move Player Around Screen
   else {
-    while (!arg->sleepGame->completed && player->lives >= 0) {
+    while (!task_isCompleted(arg->sleepGame) && player->lives >= 0) {
       switch (player->state) {
       case DEAD:
         player->lives--;
@@ -213,7 +213,7 @@ void *acceptUserInput(void *data) {
                                  // and check if game completed
 
     // Continuously read user input and execute commands
-    while (!arg->sleepGame->completed) {
+    while (!task_isCompleted(arg->sleepGame)) {
       // order select to wait for input on stdin (fd 0)
       FD_ZERO(&readfds); // init rfds to null set
       FD_SET(STDIN_FILENO, &readfds);
@@ -109,6 +109,56 @@ int64_t fatEntry(const fat32_header *const header, const uint32_t clusterNum) {
   return clusterContents;
 }
 
+fat32_entryResult fatEntryFast(const fat32_header *const header,
+                               const uint32_t clusterNum) {
+  fat32_entryResult result = {.entry = 0, .error = 0};
+  const fat32_bootSector *const bs = &header->bootSector;
+
+  // Read the entry straight from its byte offset within the FAT
+  const off_t entryOffset =
+      (off_t)bs->BPB_RsvdSecCnt * bs->BPB_BytesPerSec +
+      ((off_t)clusterNum << FAT32_OFFSET_SHIFT);
+  uint32_t entry;
+  const ssize_t bytesRead =
+      pread(header->fileDes, &entry, sizeof(entry), entryOffset);
+  if (bytesRead != (ssize_t)sizeof(entry)) {
+    result.error = bytesRead == -1 ? errno : EIO;
+    return result;
+  }
+  result.entry = entry & ENTRY_MASK;
+  return result;
+}
+
+int fatEntries(const fat32_header *const header, const uint32_t clusterNum,
+               const uint32_t numEntries, uint32_t *const entries) {
+  const fat32_bootSector *const bs = &header->bootSector;
+
+  // Read the entries straight from their byte offset within the FAT, resuming
+  // after short reads
+  const off_t entriesOffset =
+      (off_t)bs->BPB_RsvdSecCnt * bs->BPB_BytesPerSec +
+      ((off_t)clusterNum << FAT32_OFFSET_SHIFT);
+  const size_t entriesSize = (size_t)numEntries * sizeof(*entries);
+  size_t totalRead = 0;
+  while (totalRead < entriesSize) {
+    const ssize_t bytesRead =
+        pread(header->fileDes, (uint8_t *)entries + totalRead,
+              entriesSize - totalRead, entriesOffset + (off_t)totalRead);
+    if (bytesRead == -1 && errno == EINTR) {
+      continue;
+    }
+    if (bytesRead <= 0) {
+      return bytesRead == -1 ? errno : EIO;
+    }
+    totalRead += (size_t)bytesRead;
+  }
+
+  for (uint32_t entryNum = 0; entryNum < numEntries; ++entryNum) {
+    entries[entryNum] &= ENTRY_MASK;
+  }
+  return 0;
+}
+
 void readClusterBytes(const fat32_header *const header,
                       const uint32_t clusterNum, uint8_t *cluster) {
   const char fooName[] = "readClusterBytes";
@@ -25,6 +25,7 @@
 #include "fat.h"
 
 #define FIRST_DATA_CLUSTER_NUM 2
+#define FAT_SCAN_ENTRIES 16384 // FAT entries read at once scanning the FAT
 
 /**
  * @brief Set the Header Volume Id of the provided header object. Sets errno on
@@ -391,12 +392,6 @@ uint32_t nextDirEntry(const fat32_header *const header,
   const fat32_bootSector *const bs = &header->bootSector;
   const uint32_t bytesPerCluster = bs->BPB_BytesPerSec * bs->BPB_SecPerClus;
 
-  uint32_t nextCluster = fatEntry(header, clusterNum);
-  if (errno != 0) {
-    fprintf(stderr, "Failure following cluster chain in %s\n", fooName);
-    return 0;
-  }
-
   while (clusterNum != EOC_CLUSTER) {
     if (clusterNum != BAD_CLUSTER) {
       // Read entire cluster contents
@@ -427,12 +422,15 @@ uint32_t nextDirEntry(const fat32_header *const header,
       }
       dirNum = 0;
     }
-    clusterNum = nextCluster;
-    nextCluster = fatEntry(header, clusterNum);
-    if (errno != 0) {
+
+    // Follow the chain one entry at a time, never reading past its end
+    const fat32_entryResult next = fatEntryFast(header, clusterNum);
+    if (next.error != 0) {
+      errno = next.error;
       fprintf(stderr, "Failure following cluster chain in %s\n", fooName);
       return 0;
     }
+    clusterNum = next.entry;
   }
   return 0;
 }
@@ -455,22 +453,33 @@ uint32_t numFreeClusters(const fat32_header *const header) {
           bs->BPB_SecPerClus +
       FIRST_DATA_CLUSTER_NUM;
 
-  uint32_t nextCluster = fatEntry(header, clusterNum);
-  if (errno != 0) {
-    fprintf(stderr, "Failure following cluster chain in %s\n", fooName);
-    return 0;
+  // Read the FAT in batches of FAT_SCAN_ENTRIES entries, 64 KiB, rather than
+  // a syscall per entry
+  uint32_t *const entries = malloc(FAT_SCAN_ENTRIES * sizeof(uint32_t));
+  if (entries == (uint32_t *)NULL) {
+    fprintf(stderr, "Failure allocating FAT entries to scan in %s\n",
+            fooName);
+    return 0; // errno set by malloc
   }
-
   while (clusterNum < totNumClusters) {
-    numFree += (uint32_t)(nextCluster == EMPTY_CLUSTER);
-    ++clusterNum;
-    nextCluster = fatEntry(header, clusterNum);
-    if (errno != 0) {
-      fprintf(stderr, "Failure reading FAT entry for cluster %u in %s\n",
+    const uint32_t numEntries = totNumClusters - clusterNum < FAT_SCAN_ENTRIES
+                                    ? totNumClusters - clusterNum
+                                    : FAT_SCAN_ENTRIES;
+    const int readErr = fatEntries(header, clusterNum, numEntries, entries);
+    if (readErr != 0) {
+      fprintf(stderr,
+              "Failure reading FAT entries from cluster %u in %s\n",
               clusterNum, fooName);
+      free(entries);
+      errno = readErr;
       return 0;
     }
+    for (uint32_t entryNum = 0; entryNum < numEntries; ++entryNum) {
+      numFree += (uint32_t)(entries[entryNum] == EMPTY_CLUSTER);
+    }
+    clusterNum += numEntries;
   }
+  free(entries);
   return numFree;
 }
 
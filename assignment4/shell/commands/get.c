@@ -69,13 +69,6 @@ static void downloadFile(const fat32_header *const header,
   const fat32_bootSector *const bs = &header->bootSector;
   const uint32_t bytesPerCluster = bs->BPB_BytesPerSec * bs->BPB_SecPerClus;
 
-  uint32_t nextCluster = fatEntry(header, clusterNum);
-  if (errno != 0) {
-    fprintf(stderr, "Failure following cluster chain in %s\n", fooName);
-    fclose(destFile);
-    return;
-  }
-
   while (clusterNum != EOC_CLUSTER) {
     if (clusterNum != BAD_CLUSTER) {
       // Read entire cluster contents
@@ -101,13 +94,16 @@ static void downloadFile(const fat32_header *const header,
       }
       fileSize -= bytesWritten;
     }
-    clusterNum = nextCluster;
-    nextCluster = fatEntry(header, clusterNum);
-    if (errno != 0) {
+
+    // Follow the chain one entry at a time, never reading past its end
+    const fat32_entryResult next = fatEntryFast(header, clusterNum);
+    if (next.error != 0) {
+      errno = next.error;
       fprintf(stderr, "Failure following cluster chain in %s\n", fooName);
       fclose(destFile);
       return;
     }
+    clusterNum = next.entry;
   }
   fclose(destFile);
 }
@@ -0,0 +1,244 @@
+/**
+ * @file bench_containers.c
+ * @author Justen Di Ruscio
+ * @brief Benchmarks of the operations of jd-lib's containers that the shell
+ * and game run per command or per frame
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "jd_bench.h"
+
+#include <jd/hashmap.h>
+#include <jd/list.h>
+#include <jd/priority_queue.h>
+#include <jd/queue.h>
+#include <jd/string.h>
+#include <jd/vector.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_BATCH_SIZE 1024
+#define BENCH_NUM_SAMPLES 2000
+#define BENCH_NUM_KEYS 1024
+#define BENCH_MAX_SPANS 32
+
+// representative command line of the shell
+static const char benchCommandLine[] = "ls -la /usr/local/bin | grep -v jd";
+
+// consumes results so operations aren't optimized away
+static volatile size_t benchSink;
+
+// ==================== BATCHES ===============
+/**
+ * @brief Pushes batchSize ints onto an empty Vector, then frees it, so growth
+ * is included
+ *
+ */
+static void bench_vectorPushBack(void *const state, const size_t batchSize) {
+  (void)state;
+  Vector vec = vector_constructEmpty(sizeof(int));
+  for (size_t i = 0; i < batchSize; ++i) {
+    const int element = (int)i;
+    vector_pushBack(&vec, &element);
+  }
+  benchSink = vec.length;
+  vector_freeData(&vec);
+}
+
+/**
+ * @brief Pushes batchSize ints onto an empty List, then frees its nodes
+ *
+ */
+static void bench_listPushBack(void *const state, const size_t batchSize) {
+  (void)state;
+  List list = list_constructEmpty(sizeof(int));
+  for (size_t i = 0; i < batchSize; ++i) {
+    const int element = (int)i;
+    list_pushBack(&list, &element);
+  }
+  benchSink = list.length;
+  list_freeNodes(&list);
+}
+
+/**
+ * @brief Enqueues then dequeues batchSize ints; each pair is one operation
+ *
+ */
+static void bench_queue(void *const state, const size_t batchSize) {
+  Queue *const q = state;
+  for (size_t i = 0; i < batchSize; ++i) {
+    const int element = (int)i;
+    q_enqueue(q, &element);
+  }
+  for (size_t i = 0; i < batchSize; ++i) {
+    benchSink = (size_t) * (int *)q_front(q);
+    q_dequeue(q);
+  }
+}
+
+/**
+ * @brief Enqueues then pops batchSize ints with q_tryPop, which neither
+ * prints nor touches errno; each pair is one operation
+ *
+ */
+static void bench_queueTryPop(void *const state, const size_t batchSize) {
+  Queue *const q = state;
+  for (size_t i = 0; i < batchSize; ++i) {
+    const int element = (int)i;
+    q_enqueue(q, &element);
+  }
+  int element;
+  while (jd_ok(q_tryPop(q, &element))) {
+    benchSink = (size_t)element;
+  }
+}
+
+/**
+ * @brief Sums batchSize ints of a Vector through the checked vector_at
+ *
+ */
+static void bench_vectorAt(void *const state, const size_t batchSize) {
+  const Vector *const vec = state;
+  size_t sum = 0;
+  for (size_t i = 0; i < batchSize; ++i) {
+    sum += (size_t) * (int *)vector_at(vec, i);
+  }
+  benchSink = sum;
+}
+
+/**
+ * @brief Sums batchSize ints of a Vector through vector_atUnchecked
+ *
+ */
+static void bench_vectorAtUnchecked(void *const state,
+                                    const size_t batchSize) {
+  const Vector *const vec = state;
+  size_t sum = 0;
+  for (size_t i = 0; i < batchSize; ++i) {
+    sum += (size_t) * (int *)vector_atUnchecked(vec, i);
+  }
+  benchSink = sum;
+}
+
+/**
+ * @brief Splits benchCommandLine into a Vector of Strings, as the shell did
+ * per command before tokenizing into spans
+ *
+ */
+static void bench_stringSplit(void *const state, const size_t batchSize) {
+  const String *const line = state;
+  for (size_t i = 0; i < batchSize; ++i) {
+    OptionalVector words = string_split(line, " ");
+    benchSink = words.data.length;
+    vector_freeElements(&words.data);
+    vector_freeData(&words.data);
+  }
+}
+
+/**
+ * @brief Tokenizes benchCommandLine into spans, as the shell does per command
+ *
+ */
+static void bench_stringViewTokenize(void *const state,
+                                     const size_t batchSize) {
+  const StringView *const line = state;
+  const StringView delimeters = stringView_fromChar(" ");
+  StringSpan spans[BENCH_MAX_SPANS];
+  for (size_t i = 0; i < batchSize; ++i) {
+    benchSink = stringView_tokenize(*line, delimeters, spans, BENCH_MAX_SPANS);
+  }
+}
+
+/**
+ * @brief Looks up batchSize of BENCH_NUM_KEYS size_t keys in a HashMap
+ *
+ */
+static void bench_hashMapFind(void *const state, const size_t batchSize) {
+  const HashMap *const map = state;
+  for (size_t i = 0; i < batchSize; ++i) {
+    const size_t key = (i * 7919) % BENCH_NUM_KEYS;
+    benchSink = *(size_t *)hashMap_find(map, &key);
+  }
+}
+
+static int bench_compareInts(const void *const first,
+                             const void *const second) {
+  const int a = *(const int *)first;
+  const int b = *(const int *)second;
+  return (a > b) - (a < b);
+}
+
+/**
+ * @brief Pops the least of BENCH_NUM_KEYS ints from a PriorityQueue and pushes
+ * it back with a later priority, as a scheduler would; each pair is one
+ * operation
+ *
+ */
+static void bench_priorityQueue(void *const state, const size_t batchSize) {
+  PriorityQueue *const pq = state;
+  for (size_t i = 0; i < batchSize; ++i) {
+    int element;
+    pq_pop(pq, &element);
+    element += rand() % BENCH_NUM_KEYS;
+    pq_push(pq, &element, (PriorityQueueHandle *)NULL);
+  }
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+void bench_containers(void) {
+  bench_run("vector_pushBack", bench_vectorPushBack, NULL, BENCH_BATCH_SIZE,
+            BENCH_NUM_SAMPLES);
+  bench_run("list_pushBack", bench_listPushBack, NULL, BENCH_BATCH_SIZE,
+            BENCH_NUM_SAMPLES);
+
+  Queue q = q_constructEmpty(sizeof(int));
+  bench_run("q_enqueue+q_dequeue", bench_queue, &q, BENCH_BATCH_SIZE,
+            BENCH_NUM_SAMPLES);
+  bench_run("q_enqueue+q_tryPop", bench_queueTryPop, &q, BENCH_BATCH_SIZE,
+            BENCH_NUM_SAMPLES);
+  q_freeElements(&q);
+
+  Vector vec = vector_constructEmpty(sizeof(int));
+  for (int i = 0; i < BENCH_BATCH_SIZE; ++i) {
+    vector_pushBack(&vec, &i);
+  }
+  bench_run("vector_at", bench_vectorAt, &vec, BENCH_BATCH_SIZE,
+            BENCH_NUM_SAMPLES);
+  bench_run("vector_atUnchecked", bench_vectorAtUnchecked, &vec,
+            BENCH_BATCH_SIZE, BENCH_NUM_SAMPLES);
+  vector_freeData(&vec);
+
+  OptionalString line = string_copyConstructChar(benchCommandLine);
+  if (line.valid) {
+    bench_run("string_split", bench_stringSplit, &line.data, 64,
+              BENCH_NUM_SAMPLES);
+    string_freeData(&line.data);
+  }
+  StringView lineView = stringView_fromChar(benchCommandLine);
+  bench_run("stringView_tokenize", bench_stringViewTokenize, &lineView, 64,
+            BENCH_NUM_SAMPLES);
+
+  HashMap map = hashMap_constructEmpty(sizeof(size_t), sizeof(size_t),
+                                       (HashMapHasher)NULL,
+                                       (HashMapKeyEquals)NULL);
+  for (size_t key = 0; key < BENCH_NUM_KEYS; ++key) {
+    hashMap_insert(&map, &key, &key);
+  }
+  bench_run("hashMap_find", bench_hashMapFind, &map, BENCH_BATCH_SIZE,
+            BENCH_NUM_SAMPLES);
+  hashMap_freeData(&map);
+
+  PriorityQueue pq = pq_constructEmpty(sizeof(int), bench_compareInts);
+  for (int i = 0; i < BENCH_NUM_KEYS; ++i) {
+    const int element = rand() % BENCH_NUM_KEYS;
+    pq_push(&pq, &element, (PriorityQueueHandle *)NULL);
+  }
+  bench_run("pq_pop+pq_push", bench_priorityQueue, &pq, BENCH_BATCH_SIZE,
+            BENCH_NUM_SAMPLES);
+  pq_freeData(&pq);
+}
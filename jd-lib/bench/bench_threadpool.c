@@ -0,0 +1,200 @@
+/**
+ * @file bench_threadpool.c
+ * @author Justen Di Ruscio
+ * @brief Benchmarks of ThreadPool round trip latency and of throughput as the
+ * number of producers and consumers grows
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "jd_bench.h"
+
+#include <jd/threadpool.h>
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_ROUND_TRIPS 20000
+#define BENCH_SWEEP_TASKS (1u << 17)
+
+/**
+ * @brief A task of the scaling sweep, which measures its own latency from
+ * being enqueued by its producer to running on a consumer
+ *
+ */
+typedef struct BenchTask {
+  Task task;
+  uint64_t enqueuedNs;
+  uint64_t latencyNs;
+} BenchTask;
+
+/**
+ * @brief Tasks submitted by one producer of the scaling sweep
+ *
+ */
+typedef struct BenchProducer {
+  pthread_t thread;
+  ThreadPool *tp;
+  BenchTask *tasks;
+  size_t numTasks;
+} BenchProducer;
+
+// ==================== PRIVATE FUNCTIONS ===============
+static void *bench_nop(void *const arg) { return arg; }
+
+static void *bench_measureLatency(void *const arg) {
+  BenchTask *const benchTask = arg;
+  benchTask->latencyNs = bench_nowNs() - benchTask->enqueuedNs;
+  return arg;
+}
+
+/**
+ * @brief Submits one task to the pool and waits for its result, timing the
+ * whole round trip
+ *
+ */
+static void bench_roundTrip(void *const state, const size_t batchSize) {
+  ThreadPool *const tp = state;
+  for (size_t i = 0; i < batchSize; ++i) {
+    Task task;
+    void *result;
+    task_init(&task, bench_nop, tp, &result);
+    tp_enqueueImmediate(tp, &task);
+    task_getResult(&task);
+  }
+}
+
+static void *bench_produce(void *const arg) {
+  BenchProducer *const producer = arg;
+  for (size_t i = 0; i < producer->numTasks; ++i) {
+    BenchTask *const benchTask = &producer->tasks[i];
+    task_init(&benchTask->task, bench_measureLatency, benchTask, NULL);
+    benchTask->enqueuedNs = bench_nowNs();
+    tp_enqueueImmediate(producer->tp, &benchTask->task);
+  }
+  for (size_t i = 0; i < producer->numTasks; ++i) {
+    task_getResult(&producer->tasks[i].task);
+  }
+  return NULL;
+}
+
+static int bench_compareLatencies(const void *const first,
+                                  const void *const second) {
+  const uint64_t a = ((const BenchTask *)first)->latencyNs;
+  const uint64_t b = ((const BenchTask *)second)->latencyNs;
+  return (a > b) - (a < b);
+}
+
+/**
+ * @brief Allocates a pool with exactly numThreads threads in mode
+ *
+ * @return ThreadPool* initialized pool or NULL upon error
+ */
+static ThreadPool *bench_newPool(const unsigned numThreads,
+                                 const ThreadPoolMode mode) {
+  ThreadPool *const tp = malloc(sizeof(ThreadPool));
+  if (tp == (ThreadPool *)NULL) {
+    return tp;
+  }
+  ThreadPoolConfig config = tp_defaultConfig();
+  config.numInitThreads = numThreads;
+  config.minThreads = numThreads;
+  config.maxThreads = numThreads;
+  config.mode = mode;
+  if (tp_initConfig(tp, &config) != 0) {
+    free(tp);
+    return (ThreadPool *)NULL;
+  }
+  return tp;
+}
+
+/**
+ * @brief Runs BENCH_SWEEP_TASKS tasks through a pool of numThreads consumers,
+ * submitted by as many producers, and records throughput as ns/op and the
+ * enqueue to run latency of the tasks as percentiles
+ *
+ */
+static void bench_sweep(const char *const name, const unsigned numThreads,
+                        const ThreadPoolMode mode) {
+  BenchTask *const tasks = malloc(BENCH_SWEEP_TASKS * sizeof(BenchTask));
+  BenchProducer *const producers = malloc(numThreads * sizeof(BenchProducer));
+  ThreadPool *const tp = bench_newPool(numThreads, mode);
+  if (tasks == (BenchTask *)NULL || producers == (BenchProducer *)NULL ||
+      tp == (ThreadPool *)NULL) {
+    perror(name);
+    free(tasks);
+    free(producers);
+    return;
+  }
+
+  // Split tasks between producers and time them all through the pool
+  const size_t tasksPerProducer = BENCH_SWEEP_TASKS / numThreads;
+  const size_t numTasks = tasksPerProducer * numThreads;
+  const size_t startAllocations = bench_allocations();
+  const uint64_t start = bench_nowNs();
+  for (unsigned i = 0; i < numThreads; ++i) {
+    producers[i].tp = tp;
+    producers[i].tasks = tasks + i * tasksPerProducer;
+    producers[i].numTasks = tasksPerProducer;
+    pthread_create(&producers[i].thread, NULL, bench_produce, &producers[i]);
+  }
+  for (unsigned i = 0; i < numThreads; ++i) {
+    pthread_join(producers[i].thread, NULL);
+  }
+  const uint64_t elapsed = bench_nowNs() - start;
+  const size_t allocations = bench_allocations() - startAllocations;
+
+  // Summarize
+  qsort(tasks, numTasks, sizeof(BenchTask), bench_compareLatencies);
+  BenchResult result = {.threads = numThreads,
+                        .ops = numTasks,
+                        .nsPerOp = (double)elapsed / (double)numTasks,
+                        .allocsPerOp = (double)allocations / (double)numTasks,
+                        .p50Ns = (double)tasks[numTasks / 2].latencyNs,
+                        .p99Ns = (double)tasks[numTasks * 99 / 100].latencyNs};
+  snprintf(result.name, sizeof(result.name), "%s", name);
+  bench_record(&result);
+
+  tp_destroy(tp);
+  free(tp);
+  free(producers);
+  free(tasks);
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+void bench_threadpool(const unsigned maxThreads) {
+  const struct {
+    ThreadPoolMode mode;
+    const char *roundTripName;
+    const char *sweepName;
+  } modes[] = {{tp_SharedQueue, "tp_roundTrip/shared", "tp_sweep/shared"},
+               {tp_WorkStealing, "tp_roundTrip/stealing",
+                "tp_sweep/stealing"}};
+
+  for (size_t modeIdx = 0; modeIdx < sizeof(modes) / sizeof(modes[0]);
+       ++modeIdx) {
+    ThreadPool *const tp = bench_newPool(1, modes[modeIdx].mode);
+    if (tp == (ThreadPool *)NULL) {
+      perror(modes[modeIdx].roundTripName);
+      continue;
+    }
+    bench_run(modes[modeIdx].roundTripName, bench_roundTrip, tp, 1,
+              BENCH_ROUND_TRIPS);
+    tp_destroy(tp);
+    free(tp);
+
+    // Double producers and consumers up to maxThreads, including maxThreads
+    for (unsigned threads = 1; threads <= maxThreads;
+         threads = threads < maxThreads && 2 * threads > maxThreads
+                       ? maxThreads
+                       : 2 * threads) {
+      bench_sweep(modes[modeIdx].sweepName, threads, modes[modeIdx].mode);
+    }
+  }
+}
@@ -0,0 +1,181 @@
+/**
+ * @file hashmap_bench.c
+ * @author Justen Di Ruscio
+ * @brief Compares HashMap lookups against the linear scans used for lookups
+ * throughout the projects: vector_find over PIDs, strcmp over command names
+ * and strcmp over a list of per-user summaries. Prints ns per lookup of each
+ * for a range of sizes.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <jd/hashmap.h>
+#include <jd/vector.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+
+HASHMAP_DECLARE_TYPED(PidMap, pidMap, pid_t, size_t, NULL, NULL)
+HASHMAP_DECLARE_TYPED(NameMap, nameMap, const char *, unsigned,
+                      hashMap_hashCString, hashMap_equalsCString)
+
+// total key comparisons each linear scan benchmark is sized to, so every size
+// runs for roughly the same time
+#define BENCH_SCAN_BUDGET (1u << 24)
+#define BENCH_MIN_LOOKUPS (1u << 14)
+// "user" and the 20 digits of the largest size_t, with its NUL
+#define BENCH_NAME_LENGTH (sizeof("user") + 20)
+
+static const size_t benchSizes[] = {4, 16, 64, 256, 1024, 4096};
+static const size_t numBenchSizes = sizeof(benchSizes) / sizeof(benchSizes[0]);
+
+// consumes results so lookups aren't optimized away
+static volatile size_t benchSink;
+
+static uint64_t bench_nowNs(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static size_t bench_numLookups(const size_t size) {
+  const size_t lookups = BENCH_SCAN_BUDGET / size;
+  return lookups < BENCH_MIN_LOOKUPS ? BENCH_MIN_LOOKUPS : lookups;
+}
+
+/**
+ * @brief Fills indices with a random permutation of 0 to size - 1, the order
+ * lookups are made in
+ *
+ */
+static void bench_shuffledIndices(size_t *const indices, const size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    indices[i] = i;
+  }
+  for (size_t i = size - 1; i > 0; --i) {
+    const size_t j = (size_t)rand() % (i + 1);
+    const size_t tmp = indices[i];
+    indices[i] = indices[j];
+    indices[j] = tmp;
+  }
+}
+
+static void bench_report(const char *const pattern, const size_t size,
+                         const double linearNs, const double hashNs) {
+  printf("%-14s %6zu %12.1f %12.1f %9.1fx\n", pattern, size, linearNs, hashNs,
+         linearNs / hashNs);
+}
+
+/**
+ * @brief PIDs tracked by the shell's job lists, as in bg.c and fg.c, which
+ * find a PID with vector_find
+ *
+ */
+static void bench_pids(const size_t size, size_t *const order) {
+  Vector pids = vector_constructCapacity(size, sizeof(pid_t)).data;
+  PidMap pidIndices = pidMap_constructEmpty();
+  for (size_t i = 0; i < size; ++i) {
+    const pid_t pid = (pid_t)(1000 + 7 * i);
+    vector_pushBack(&pids, &pid);
+    pidMap_insert(&pidIndices, pid, i);
+  }
+  bench_shuffledIndices(order, size);
+  const size_t lookups = bench_numLookups(size);
+
+  size_t sum = 0;
+  uint64_t start = bench_nowNs();
+  for (size_t i = 0; i < lookups; ++i) {
+    const pid_t pid = (pid_t)(1000 + 7 * order[i % size]);
+    sum += (size_t)vector_find(&pids, &pid);
+  }
+  const double linearNs = (double)(bench_nowNs() - start) / (double)lookups;
+
+  start = bench_nowNs();
+  for (size_t i = 0; i < lookups; ++i) {
+    sum += *pidMap_find(&pidIndices, (pid_t)(1000 + 7 * order[i % size]));
+  }
+  const double hashNs = (double)(bench_nowNs() - start) / (double)lookups;
+
+  benchSink = sum;
+  bench_report("pid", size, linearNs, hashNs);
+  vector_freeData(&pids);
+  pidMap_freeData(&pidIndices);
+}
+
+/**
+ * @brief Names looked up by strcmp over a table, as parseCommandName does over
+ * builtin names and a1.c does over its list of per-user summaries. Half of
+ * the lookups miss, as most commands aren't builtins.
+ *
+ */
+static void bench_names(const size_t size, size_t *const order) {
+  char(*const names)[BENCH_NAME_LENGTH] = malloc(2 * size * BENCH_NAME_LENGTH);
+  const char **const table = malloc(size * sizeof(char *));
+  NameMap nameIndices = nameMap_constructEmpty();
+  for (size_t i = 0; i < 2 * size; ++i) {
+    snprintf(names[i], BENCH_NAME_LENGTH, "user%zu", i);
+  }
+  for (size_t i = 0; i < size; ++i) {
+    table[i] = names[i];
+    nameMap_insert(&nameIndices, names[i], (unsigned)i);
+  }
+  bench_shuffledIndices(order, size);
+  const size_t lookups = bench_numLookups(size);
+
+  size_t sum = 0;
+  uint64_t start = bench_nowNs();
+  for (size_t i = 0; i < lookups; ++i) {
+    const char *const name = names[order[i % size] + (i & 1) * size];
+    for (size_t entry = 0; entry < size; ++entry) {
+      if (strcmp(table[entry], name) == 0) {
+        sum += entry;
+        break;
+      }
+    }
+  }
+  const double linearNs = (double)(bench_nowNs() - start) / (double)lookups;
+
+  start = bench_nowNs();
+  for (size_t i = 0; i < lookups; ++i) {
+    const char *const name = names[order[i % size] + (i & 1) * size];
+    const unsigned *const entry = nameMap_find(&nameIndices, name);
+    sum += entry != (unsigned *)NULL ? *entry : 0;
+  }
+  const double hashNs = (double)(bench_nowNs() - start) / (double)lookups;
+
+  benchSink = sum;
+  bench_report("name", size, linearNs, hashNs);
+  nameMap_freeData(&nameIndices);
+  free(table);
+  free(names);
+}
+
+int main(void) {
+  srand(1);
+  size_t *const order = malloc(benchSizes[numBenchSizes - 1] * sizeof(size_t));
+  if (order == (size_t *)NULL) {
+    perror("malloc");
+    return EXIT_FAILURE;
+  }
+
+  printf("%-14s %6s %12s %12s %10s\n", "pattern", "size", "linear ns/op",
+         "hashmap ns/op", "speedup");
+  for (size_t i = 0; i < numBenchSizes; ++i) {
+    bench_pids(benchSizes[i], order);
+  }
+  for (size_t i = 0; i < numBenchSizes; ++i) {
+    bench_names(benchSizes[i], order);
+  }
+
+  free(order);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,286 @@
+/**
+ * @file jd_bench.c
+ * @author Justen Di Ruscio
+ * @brief Harness and entry point of jd_bench. Results are printed as a table
+ * and optionally saved as JSON, one result per line, which a later run can
+ * compare itself against:
+ *
+ *   jd_bench --json before.json
+ *   jd_bench --compare before.json
+ *
+ * When jd-lib is built with JD_INSTRUMENT, its counters are printed after the
+ * results, and --trace saves its trace spans for chrome://tracing or Perfetto.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "jd_bench.h"
+
+#include <jd/instrument.h>
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_MAX_RESULTS 128
+
+static atomic_size_t numAllocations;
+
+static BenchResult results[BENCH_MAX_RESULTS];
+static size_t numResults;
+
+// baseline loaded by --compare, matched to results by name and threads
+static BenchResult baseline[BENCH_MAX_RESULTS];
+static size_t numBaseline;
+
+// ==================== ALLOCATION COUNTING ===============
+// The build links with -Wl,--wrap for each of these, so every call to them,
+// including from libjd.a, lands here
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+  atomic_fetch_add_explicit(&numAllocations, 1, memory_order_relaxed);
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  atomic_fetch_add_explicit(&numAllocations, 1, memory_order_relaxed);
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  atomic_fetch_add_explicit(&numAllocations, 1, memory_order_relaxed);
+  return __real_realloc(ptr, size);
+}
+
+// ==================== PRIVATE FUNCTIONS ===============
+static int bench_compareDoubles(const void *const first,
+                                const void *const second) {
+  const double a = *(const double *)first;
+  const double b = *(const double *)second;
+  return (a > b) - (a < b);
+}
+
+/**
+ * @brief Finds the baseline result matching result, if --compare loaded one
+ *
+ * @param result result to match
+ * @return const BenchResult* matching baseline or NULL
+ */
+static const BenchResult *bench_findBaseline(const BenchResult *const result) {
+  for (size_t i = 0; i < numBaseline; ++i) {
+    if (baseline[i].threads == result->threads &&
+        strcmp(baseline[i].name, result->name) == 0) {
+      return &baseline[i];
+    }
+  }
+  return (BenchResult *)NULL;
+}
+
+/**
+ * @brief Loads results saved with --json by a previous run
+ *
+ * @param path file to load
+ * @return true successfully loaded results
+ * @return false failed to open path
+ */
+static bool bench_loadBaseline(const char *const path) {
+  FILE *const file = fopen(path, "r");
+  if (file == (FILE *)NULL) {
+    perror(path);
+    return false;
+  }
+  char line[512];
+  while (numBaseline < BENCH_MAX_RESULTS &&
+         fgets(line, sizeof(line), file) != (char *)NULL) {
+    BenchResult *const result = &baseline[numBaseline];
+    const int matched =
+        sscanf(line,
+               " {\"name\": \"%63[^\"]\", \"threads\": %u, \"ops\": %zu, "
+               "\"ns_per_op\": %lf, \"allocs_per_op\": %lf, \"p50_ns\": %lf, "
+               "\"p99_ns\": %lf",
+               result->name, &result->threads, &result->ops,
+               &result->nsPerOp, &result->allocsPerOp, &result->p50Ns,
+               &result->p99Ns);
+    if (matched == 7) {
+      ++numBaseline;
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+/**
+ * @brief Saves every recorded result as a JSON array, one result per line
+ *
+ * @param path file to write
+ * @return true successfully saved results
+ * @return false failed to open path
+ */
+static bool bench_saveJson(const char *const path) {
+  FILE *const file = fopen(path, "w");
+  if (file == (FILE *)NULL) {
+    perror(path);
+    return false;
+  }
+  fprintf(file, "[\n");
+  for (size_t i = 0; i < numResults; ++i) {
+    const BenchResult *const result = &results[i];
+    fprintf(file,
+            "{\"name\": \"%s\", \"threads\": %u, \"ops\": %zu, "
+            "\"ns_per_op\": %.3f, \"allocs_per_op\": %.4f, \"p50_ns\": %.3f, "
+            "\"p99_ns\": %.3f}%s\n",
+            result->name, result->threads, result->ops, result->nsPerOp,
+            result->allocsPerOp, result->p50Ns, result->p99Ns,
+            i + 1 < numResults ? "," : "");
+  }
+  fprintf(file, "]\n");
+  fclose(file);
+  return true;
+}
+
+static void bench_usage(const char *const program) {
+  fprintf(stderr,
+          "usage: %s [--json FILE] [--compare FILE] [--threads N] "
+          "[--trace FILE]\n"
+          "  --json FILE     save results as JSON\n"
+          "  --compare FILE  show change against results saved with --json\n"
+          "  --threads N     most producers and consumers in the thread pool\n"
+          "                  sweep; defaults to the number of online CPUs\n"
+          "  --trace FILE    save jd-lib's trace events; needs JD_INSTRUMENT\n",
+          program);
+}
+
+#if defined(JD_INSTRUMENT)
+/**
+ * @brief Prints jd-lib's counters, summed over the whole run
+ *
+ */
+static void bench_printCounters(void) {
+  printf("\n%-32s %20s\n", "counter", "value");
+  for (unsigned cIdx = 0; cIdx < jd_numCounters; ++cIdx) {
+    printf("%-32s %20llu\n", jd_counterName((JdCounter)cIdx),
+           (unsigned long long)jd_counterRead((JdCounter)cIdx));
+  }
+}
+#endif
+
+// ==================== PUBLIC FUNCTIONS ===============
+uint64_t bench_nowNs(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+size_t bench_allocations(void) {
+  return atomic_load_explicit(&numAllocations, memory_order_relaxed);
+}
+
+void bench_run(const char *const name, const BenchBatch batch,
+               void *const state, const size_t batchSize,
+               const size_t numSamples) {
+  double *const samples = malloc(numSamples * sizeof(double));
+  if (samples == (double *)NULL) {
+    perror("bench_run");
+    return;
+  }
+
+  // Warm up caches, the branch predictor and the allocator
+  batch(state, batchSize);
+
+  // Time each batch
+  const size_t startAllocations = bench_allocations();
+  uint64_t totalNs = 0;
+  for (size_t sample = 0; sample < numSamples; ++sample) {
+    const uint64_t start = bench_nowNs();
+    batch(state, batchSize);
+    const uint64_t elapsed = bench_nowNs() - start;
+    totalNs += elapsed;
+    samples[sample] = (double)elapsed / (double)batchSize;
+  }
+  const size_t allocations = bench_allocations() - startAllocations;
+
+  // Summarize
+  qsort(samples, numSamples, sizeof(double), bench_compareDoubles);
+  BenchResult result = {.threads = 1,
+                        .ops = batchSize * numSamples,
+                        .p50Ns = samples[numSamples / 2],
+                        .p99Ns = samples[numSamples * 99 / 100]};
+  snprintf(result.name, sizeof(result.name), "%s", name);
+  result.nsPerOp = (double)totalNs / (double)result.ops;
+  result.allocsPerOp = (double)allocations / (double)result.ops;
+  free(samples);
+  bench_record(&result);
+}
+
+void bench_record(const BenchResult *const result) {
+  char change[16] = "";
+  const BenchResult *const before = bench_findBaseline(result);
+  if (before != (BenchResult *)NULL && before->nsPerOp > 0) {
+    snprintf(change, sizeof(change), "%+.1f%%",
+             100.0 * (result->nsPerOp - before->nsPerOp) / before->nsPerOp);
+  }
+  printf("%-32s %7u %11.1f %11.3f %10.1f %10.1f %9s\n", result->name,
+         result->threads, result->nsPerOp, result->allocsPerOp, result->p50Ns,
+         result->p99Ns, change);
+  fflush(stdout);
+  if (numResults < BENCH_MAX_RESULTS) {
+    results[numResults++] = *result;
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *jsonPath = (char *)NULL;
+  long onlineCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned maxThreads = onlineCpus > 0 ? (unsigned)onlineCpus : 1;
+
+  // Parse Arguments
+  for (int argIdx = 1; argIdx < argc; ++argIdx) {
+    const bool hasValue = argIdx + 1 < argc;
+    if (strcmp(argv[argIdx], "--json") == 0 && hasValue) {
+      jsonPath = argv[++argIdx];
+    } else if (strcmp(argv[argIdx], "--compare") == 0 && hasValue) {
+      if (!bench_loadBaseline(argv[++argIdx])) {
+        return EXIT_FAILURE;
+      }
+    } else if (strcmp(argv[argIdx], "--trace") == 0 && hasValue) {
+      if (!jd_traceStart(argv[++argIdx])) {
+        return EXIT_FAILURE;
+      }
+    } else if (strcmp(argv[argIdx], "--threads") == 0 && hasValue) {
+      maxThreads = (unsigned)strtoul(argv[++argIdx], (char **)NULL, 10);
+      if (maxThreads == 0) {
+        maxThreads = 1;
+      }
+    } else {
+      bench_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Benchmark
+  printf("%-32s %7s %11s %11s %10s %10s %9s\n", "benchmark", "threads",
+         "ns/op", "allocs/op", "p50 ns", "p99 ns", "change");
+  bench_containers();
+  bench_threadpool(maxThreads);
+  jd_traceStop();
+#if defined(JD_INSTRUMENT)
+  bench_printCounters();
+#endif
+
+  if (jsonPath != (char *)NULL && !bench_saveJson(jsonPath)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
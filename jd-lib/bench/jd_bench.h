@@ -0,0 +1,90 @@
+#pragma once
+/**
+ * @file jd_bench.h
+ * @author Justen Di Ruscio
+ * @brief Declarations for the harness of jd_bench, which times batches of an
+ * operation and reports ns/op, heap allocations/op and percentiles of the
+ * per-op time of each batch
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_NAME_LENGTH 64
+
+/**
+ * @brief Measurements of one benchmark
+ *
+ */
+typedef struct BenchResult {
+  char name[BENCH_NAME_LENGTH];
+  unsigned threads;   // producers and consumers, or 1 for a single thread
+  size_t ops;         // operations timed
+  double nsPerOp;     // mean
+  double allocsPerOp; // calls to malloc, calloc and realloc
+  double p50Ns;       // median per-op time of a batch
+  double p99Ns;       // 99th percentile per-op time of a batch
+} BenchResult;
+
+/**
+ * @brief Runs batchSize operations of a benchmark on its state
+ *
+ */
+typedef void (*BenchBatch)(void *const state, const size_t batchSize);
+
+/**
+ * @brief Monotonic time
+ *
+ * @return uint64_t nanoseconds since an arbitrary point
+ */
+uint64_t bench_nowNs(void);
+
+/**
+ * @brief Number of heap allocations made by every thread so far, counted by
+ * wrapping malloc, calloc and realloc at link time
+ *
+ * @return size_t allocations
+ */
+size_t bench_allocations(void);
+
+/**
+ * @brief Runs one untimed batch to warm up, then numSamples timed batches of
+ * batchSize operations, and records the result under name
+ *
+ * @param name name of the benchmark
+ * @param batch runs the operations
+ * @param state passed to batch
+ * @param batchSize operations per batch; 1 to time each operation alone
+ * @param numSamples batches to time
+ */
+void bench_run(const char *const name, const BenchBatch batch,
+               void *const state, const size_t batchSize,
+               const size_t numSamples);
+
+/**
+ * @brief Records a result measured outside of bench_run, printing it and
+ * saving it for the JSON output
+ *
+ * @param result measurements to record
+ */
+void bench_record(const BenchResult *const result);
+
+/**
+ * @brief Benchmarks Vector, List, Queue, String, HashMap and PriorityQueue
+ *
+ */
+void bench_containers(void);
+
+/**
+ * @brief Benchmarks thread pool round trip latency, and throughput over 1 to
+ * maxThreads producers and as many consumers
+ *
+ * @param maxThreads most producers and consumers in the scaling sweep
+ */
+void bench_threadpool(const unsigned maxThreads);
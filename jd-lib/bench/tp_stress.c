@@ -0,0 +1,430 @@
+/**
+ * @file tp_stress.c
+ * @author Justen Di Ruscio
+ * @brief Stress test of ThreadPool and Task lifecycles, meant to be run under
+ * ThreadSanitizer and AddressSanitizer:
+ *
+ *   cmake -S jd-lib -B build-tsan -DJD_SANITIZE=thread
+ *   cmake --build build-tsan && ./build-tsan/bench/tp_stress --tasks 100000
+ *
+ * Each round submits tasks with randomized delays from several producers,
+ * releasing half of them while they may still be running or finishing and
+ * chaining continuations onto others, then destroys the pool while it's still
+ * busy. Every task must run exactly once and no waiter may hang. The time
+ * taken by tp_destroy, including draining the tasks left waiting, and by
+ * destroying an idle pool is reported as teardown latency.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <jd/threadpool.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STRESS_PRODUCERS 4
+#define STRESS_DELAYED_TASKS 16 // never due before the pool is destroyed
+#define STRESS_MAX_ROUNDS 1024
+#define STRESS_SPIN 256 // delays above this are sleeps rather than spins
+
+/**
+ * @brief Counts of one round, shared by its producers and tasks
+ *
+ */
+typedef struct StressRound {
+  ThreadPool *tp;
+  size_t tasksPerProducer;
+  atomic_size_t tasksRun;
+  atomic_size_t continuationsRun;
+  size_t continuationsExpected; // set by producers before they're joined
+} StressRound;
+
+/**
+ * @brief A task taken from the pool with tp_acquireTask, so it may be released
+ * while the pool still holds it
+ *
+ */
+typedef struct StressTask {
+  Task task;
+  StressRound *round;
+  unsigned delay; // busy iterations, or sleep microseconds above STRESS_SPIN
+} StressTask;
+
+/**
+ * @brief A task owned and awaited by its producer, with a continuation run in
+ * the pool once it completes
+ *
+ */
+typedef struct StressOwned {
+  StressTask work;
+  Task continuation;
+} StressOwned;
+
+typedef struct StressProducer {
+  pthread_t thread;
+  StressRound *round;
+  unsigned randomState;
+  size_t continuations;
+  bool failed;
+} StressProducer;
+
+// ==================== PRIVATE FUNCTIONS ===============
+static uint64_t stress_nowNs(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static unsigned stress_random(unsigned *const state) {
+  unsigned x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+/**
+ * @brief Mostly no delay, sometimes a short spin and rarely a sleep of up to
+ * 50us, so tasks finish out of order and threads idle, steal and contend
+ *
+ */
+static unsigned stress_randomDelay(unsigned *const state) {
+  const unsigned roll = stress_random(state);
+  if (roll % 64 == 0) {
+    return STRESS_SPIN + 1 + roll / 64 % 50;
+  }
+  if (roll % 8 == 0) {
+    return roll / 8 % STRESS_SPIN;
+  }
+  return 0;
+}
+
+static void *stress_work(void *const arg) {
+  StressTask *const stressTask = arg;
+  if (stressTask->delay > STRESS_SPIN) {
+    const struct timespec sleep = {
+        .tv_nsec = (long)(stressTask->delay - STRESS_SPIN) * 1000};
+    nanosleep(&sleep, NULL);
+  } else {
+    for (volatile unsigned i = 0; i < stressTask->delay; ++i) {
+    }
+  }
+  atomic_fetch_add(&stressTask->round->tasksRun, 1);
+  return arg;
+}
+
+static void *stress_continue(void *const arg) {
+  StressRound *const round = arg;
+  atomic_fetch_add(&round->continuationsRun, 1);
+  return arg;
+}
+
+/**
+ * @brief Submits the producer's share of the round. Even tasks are acquired
+ * from the pool and released right after being enqueued, racing the pool
+ * running them, or right after being marked completed or waited on, racing
+ * the pool finishing them. Odd ones are owned by the producer, which waits on them and on
+ * their continuations before returning, since they live on its stack.
+ *
+ */
+static void *stress_produce(void *const arg) {
+  StressProducer *const producer = arg;
+  StressRound *const round = producer->round;
+
+  enum { ownedBatch = 64 };
+  StressOwned owned[ownedBatch];
+  size_t numOwned = 0;
+
+  for (size_t i = 0; i < round->tasksPerProducer; ++i) {
+    const unsigned delay = stress_randomDelay(&producer->randomState);
+    if (i % 2 == 0) {
+      StressTask *const stressTask =
+          (StressTask *)tp_acquireTask(round->tp, sizeof(StressTask));
+      if (stressTask == (StressTask *)NULL) {
+        producer->failed = true;
+        break;
+      }
+      task_init(&stressTask->task, stress_work, stressTask, NULL);
+      stressTask->round = round;
+      stressTask->delay = delay;
+      if (tp_enqueueImmediate(round->tp, &stressTask->task) != 0) {
+        producer->failed = true;
+        break;
+      }
+      // Some are completed or waited on first, releasing them as the pool
+      // may still be finishing them
+      if (i % 8 == 2) {
+        task_markCompleted(&stressTask->task);
+      } else if (i % 8 == 6) {
+        task_getResult(&stressTask->task);
+      }
+      if (tp_releaseTask(round->tp, &stressTask->task) != 0) {
+        producer->failed = true;
+        break;
+      }
+      continue;
+    }
+
+    StressOwned *const next = &owned[numOwned++];
+    task_init(&next->work.task, stress_work, &next->work, NULL);
+    next->work.round = round;
+    next->work.delay = delay;
+    task_init(&next->continuation, stress_continue, round, NULL);
+    if (task_then(&next->work.task, &next->continuation, round->tp) != 0 ||
+        tp_enqueueImmediate(round->tp, &next->work.task) != 0) {
+      --numOwned; // may never complete, so it isn't waited on
+      producer->failed = true;
+      break;
+    }
+    ++producer->continuations;
+
+    // Wait on the batch, out of order, before reusing its stack space
+    if (numOwned == ownedBatch || i + 2 >= round->tasksPerProducer) {
+      for (size_t o = numOwned; o > 0; --o) {
+        task_getResult(&owned[o - 1].continuation);
+        task_getResult(&owned[o - 1].work.task);
+      }
+      numOwned = 0;
+    }
+  }
+
+  // Never leave owned tasks referring to this stack
+  for (size_t o = 0; o < numOwned; ++o) {
+    task_getResult(&owned[o].continuation);
+  }
+  return NULL;
+}
+
+static int stress_compareLatencies(const void *const first,
+                                   const void *const second) {
+  const uint64_t a = *(const uint64_t *)first;
+  const uint64_t b = *(const uint64_t *)second;
+  return (a > b) - (a < b);
+}
+
+static void stress_printLatencies(const char *const name,
+                                  uint64_t *const latencies,
+                                  const size_t numLatencies) {
+  qsort(latencies, numLatencies, sizeof(uint64_t), stress_compareLatencies);
+  printf("%-28s %8zu %12.1f %12.1f %12.1f\n", name, numLatencies,
+         (double)latencies[numLatencies / 2] / 1000.0,
+         (double)latencies[numLatencies * 99 / 100] / 1000.0,
+         (double)latencies[numLatencies - 1] / 1000.0);
+}
+
+static ThreadPool *stress_newPool(const ThreadPoolMode mode,
+                                  const unsigned maxThreads) {
+  ThreadPool *const tp = malloc(sizeof(ThreadPool));
+  if (tp == (ThreadPool *)NULL) {
+    return tp;
+  }
+  ThreadPoolConfig config = tp_defaultConfig();
+  config.numInitThreads = 2;
+  config.minThreads = 1;
+  config.maxThreads = maxThreads;
+  config.idleTimeoutMs = 1; // reap threads while tasks are still arriving
+  config.mode = mode;
+  if (tp_initConfig(tp, &config) != 0) {
+    free(tp);
+    return (ThreadPool *)NULL;
+  }
+  return tp;
+}
+
+/**
+ * @brief Runs one round in mode, destroying the pool while its producers'
+ * last tasks may still be waiting, and checks every task ran exactly once
+ * while those delayed past it were cancelled
+ *
+ * @param teardownNs set to the time tp_destroy took
+ * @return true every task and continuation ran exactly once
+ * @return false otherwise
+ */
+static bool stress_round(const ThreadPoolMode mode, const size_t numTasks,
+                         unsigned *const randomState,
+                         uint64_t *const teardownNs) {
+  ThreadPool *const tp = stress_newPool(mode, STRESS_PRODUCERS * 2);
+  if (tp == (ThreadPool *)NULL) {
+    perror("stress_newPool");
+    return false;
+  }
+  StressRound round = {.tp = tp,
+                       .tasksPerProducer = numTasks / STRESS_PRODUCERS};
+  atomic_init(&round.tasksRun, 0);
+  atomic_init(&round.continuationsRun, 0);
+
+  // Delayed tasks the pool is destroyed before, which must never run and are
+  // completed with ECANCELED instead. As many again are acquired and released
+  // right away, so tp_destroy must recycle them.
+  Task delayed[STRESS_DELAYED_TASKS];
+  for (size_t dIdx = 0; dIdx < STRESS_DELAYED_TASKS; ++dIdx) {
+    task_init(&delayed[dIdx], stress_continue, &round, NULL);
+    tp_enqueueDelayed(tp, &delayed[dIdx], 60000);
+    Task *const released = tp_acquireTask(tp, sizeof(Task));
+    if (released != (Task *)NULL) {
+      task_init(released, stress_continue, &round, NULL);
+      tp_enqueueDelayed(tp, released, 60000);
+      tp_releaseTask(tp, released);
+    }
+  }
+
+  StressProducer producers[STRESS_PRODUCERS];
+  memset(producers, 0, sizeof(producers));
+  for (unsigned pIdx = 0; pIdx < STRESS_PRODUCERS; ++pIdx) {
+    producers[pIdx].round = &round;
+    producers[pIdx].randomState = stress_random(randomState) | 1u;
+    pthread_create(&producers[pIdx].thread, NULL, stress_produce,
+                   &producers[pIdx]);
+  }
+  bool failed = false;
+  for (unsigned pIdx = 0; pIdx < STRESS_PRODUCERS; ++pIdx) {
+    pthread_join(producers[pIdx].thread, NULL);
+    failed = failed || producers[pIdx].failed;
+    round.continuationsExpected += producers[pIdx].continuations;
+  }
+
+  // Released tasks may still be waiting, so this also times draining them
+  const uint64_t start = stress_nowNs();
+  const bool destroyed = tp_destroy(tp);
+  *teardownNs = stress_nowNs() - start;
+  free(tp);
+  size_t delayedCancelled = 0;
+  for (size_t dIdx = 0; dIdx < STRESS_DELAYED_TASKS; ++dIdx) {
+    if (task_isCompleted(&delayed[dIdx]) &&
+        delayed[dIdx].fooErrno == ECANCELED) {
+      ++delayedCancelled;
+    }
+  }
+
+  const size_t tasksRun = atomic_load(&round.tasksRun);
+  const size_t continuationsRun = atomic_load(&round.continuationsRun);
+  const size_t tasksExpected = round.tasksPerProducer * STRESS_PRODUCERS;
+  if (!destroyed || failed || tasksRun != tasksExpected ||
+      continuationsRun != round.continuationsExpected ||
+      delayedCancelled != STRESS_DELAYED_TASKS) {
+    fprintf(stderr,
+            "round failed: destroyed %d, producer failed %d, %zu of %zu "
+            "tasks and %zu of %zu continuations run, %zu of %d delayed "
+            "tasks cancelled\n",
+            destroyed, failed, tasksRun, tasksExpected, continuationsRun,
+            round.continuationsExpected, delayedCancelled,
+            STRESS_DELAYED_TASKS);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Times destroying a pool of numThreads threads idling for a task
+ *
+ * @return uint64_t nanoseconds tp_destroy took, or 0 upon error
+ */
+static uint64_t stress_idleTeardown(const ThreadPoolMode mode,
+                                    const unsigned numThreads) {
+  ThreadPool *const tp = malloc(sizeof(ThreadPool));
+  if (tp == (ThreadPool *)NULL) {
+    return 0;
+  }
+  ThreadPoolConfig config = tp_defaultConfig();
+  config.numInitThreads = numThreads;
+  config.mode = mode;
+  if (tp_initConfig(tp, &config) != 0) {
+    free(tp);
+    return 0;
+  }
+
+  // let every thread reach its wait
+  const struct timespec settle = {.tv_nsec = 1000000};
+  nanosleep(&settle, NULL);
+
+  const uint64_t start = stress_nowNs();
+  const bool destroyed = tp_destroy(tp);
+  const uint64_t elapsed = stress_nowNs() - start;
+  free(tp);
+  return destroyed ? elapsed : 0;
+}
+
+static void stress_usage(const char *const program) {
+  fprintf(stderr,
+          "usage: %s [--tasks N] [--rounds N] [--seed N]\n"
+          "  --tasks N   tasks submitted per mode, split over the rounds;\n"
+          "              defaults to 1000000\n"
+          "  --rounds N  pools created and destroyed while busy per mode;\n"
+          "              defaults to 64\n"
+          "  --seed N    seed of the random delays\n",
+          program);
+}
+
+// ==================== MAIN ===============
+int main(int argc, char **argv) {
+  size_t numTasks = 1000000;
+  size_t numRounds = 64;
+  unsigned seed = (unsigned)stress_nowNs() | 1u;
+  for (int argIdx = 1; argIdx < argc; ++argIdx) {
+    if (strcmp(argv[argIdx], "--tasks") == 0 && argIdx + 1 < argc) {
+      numTasks = strtoul(argv[++argIdx], NULL, 10);
+    } else if (strcmp(argv[argIdx], "--rounds") == 0 && argIdx + 1 < argc) {
+      numRounds = strtoul(argv[++argIdx], NULL, 10);
+    } else if (strcmp(argv[argIdx], "--seed") == 0 && argIdx + 1 < argc) {
+      seed = (unsigned)strtoul(argv[++argIdx], NULL, 10) | 1u;
+    } else {
+      stress_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (numRounds == 0 || numRounds > STRESS_MAX_ROUNDS ||
+      numTasks < numRounds * STRESS_PRODUCERS) {
+    stress_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  printf("seed %u, %zu tasks in %zu rounds per mode\n\n", seed, numTasks,
+         numRounds);
+
+  const struct {
+    ThreadPoolMode mode;
+    const char *busyName;
+    const char *idleName;
+  } modes[] = {{tp_SharedQueue, "teardown_busy/shared", "teardown_idle/shared"},
+               {tp_WorkStealing, "teardown_busy/stealing",
+                "teardown_idle/stealing"}};
+
+  static uint64_t latencies[STRESS_MAX_ROUNDS];
+  bool passed = true;
+  printf("%-28s %8s %12s %12s %12s\n", "teardown", "rounds", "p50_us",
+         "p99_us", "max_us");
+  for (size_t modeIdx = 0; modeIdx < sizeof(modes) / sizeof(modes[0]);
+       ++modeIdx) {
+    unsigned randomState = seed;
+    for (size_t rIdx = 0; rIdx < numRounds; ++rIdx) {
+      if (!stress_round(modes[modeIdx].mode, numTasks / numRounds,
+                        &randomState, &latencies[rIdx])) {
+        fprintf(stderr, "%s failed in round %zu with seed %u\n",
+                modes[modeIdx].busyName, rIdx, seed);
+        return EXIT_FAILURE;
+      }
+    }
+    stress_printLatencies(modes[modeIdx].busyName, latencies, numRounds);
+
+    for (size_t rIdx = 0; rIdx < numRounds; ++rIdx) {
+      latencies[rIdx] =
+          stress_idleTeardown(modes[modeIdx].mode, STRESS_PRODUCERS * 2);
+      passed = passed && latencies[rIdx] != 0;
+    }
+    stress_printLatencies(modes[modeIdx].idleName, latencies, numRounds);
+  }
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
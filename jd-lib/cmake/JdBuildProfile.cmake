@@ -0,0 +1,51 @@
+# Build profile shared by jd-lib and the programs linking it, so both halves
+# of every binary are optimized alike. Included once, before any target.
+#
+#   -DCMAKE_BUILD_TYPE=Release|RelWithDebInfo|Debug   defaults to Release
+#   -DJD_MARCH=native                                 tune for a CPU
+#   -DJD_PGO=GENERATE, run the programs, then -DJD_PGO=USE
+#   -DJD_SANITIZE=thread                              or address,undefined
+include_guard(GLOBAL)
+
+# Optimize unless told otherwise; single-config generators default to no flags
+get_property(JD_MULTI_CONFIG GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG)
+if(NOT JD_MULTI_CONFIG AND NOT CMAKE_BUILD_TYPE)
+    set(CMAKE_BUILD_TYPE Release CACHE STRING
+        "Build type: Debug, Release, RelWithDebInfo or MinSizeRel" FORCE)
+endif()
+
+# enable interprocedural linker optimization if available
+include(CheckIPOSupported)
+check_ipo_supported(RESULT JD_IPO_SUPPORTED)
+if(JD_IPO_SUPPORTED)
+    set(CMAKE_INTERPROCEDURAL_OPTIMIZATION TRUE)
+endif()
+
+# Instruction set to target; empty keeps the compiler's portable default
+set(JD_MARCH "" CACHE STRING "Value of -march, like native; empty for none")
+if(JD_MARCH)
+    add_compile_options(-march=${JD_MARCH})
+endif()
+
+# Profile guided optimization: GENERATE builds instrumented binaries that
+# write profiles to JD_PGO_DIR when run, which USE then optimizes with
+set(JD_PGO OFF CACHE STRING "Profile guided optimization: OFF, GENERATE or USE")
+set_property(CACHE JD_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(JD_PGO_DIR ${CMAKE_BINARY_DIR}/pgo CACHE PATH "Directory of PGO profiles")
+if(JD_PGO STREQUAL "GENERATE")
+    add_compile_options(-fprofile-generate=${JD_PGO_DIR} -fprofile-update=atomic)
+    add_link_options(-fprofile-generate=${JD_PGO_DIR})
+elseif(JD_PGO STREQUAL "USE")
+    add_compile_options(-fprofile-use=${JD_PGO_DIR} -fprofile-correction
+                        -Wno-missing-profile)
+    add_link_options(-fprofile-use=${JD_PGO_DIR})
+elseif(JD_PGO)
+    message(FATAL_ERROR "JD_PGO must be OFF, GENERATE or USE, not ${JD_PGO}")
+endif()
+
+# Sanitizers to build everything with, as a value of -fsanitize
+set(JD_SANITIZE "" CACHE STRING "Value of -fsanitize, like thread; empty for none")
+if(JD_SANITIZE)
+    add_compile_options(-fsanitize=${JD_SANITIZE} -fno-omit-frame-pointer)
+    add_link_options(-fsanitize=${JD_SANITIZE})
+endif()
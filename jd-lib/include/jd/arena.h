@@ -0,0 +1,86 @@
+#pragma once
+/**
+ * @file arena.h
+ * @author Justen Di Ruscio
+ * @brief Declarations for a bump allocator. Allocations are carved out of
+ * large blocks and never freed individually; the whole arena is released at
+ * once with arena_reset or arena_freeData.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stddef.h>
+
+/**
+ * @brief Block of memory allocations are bumped out of. Blocks are chained
+ * newest first.
+ *
+ */
+typedef struct ArenaBlock {
+  struct ArenaBlock* next;
+  size_t capacity;  // bytes of data
+  size_t used;      // bytes of data handed out
+  max_align_t data[];
+} ArenaBlock;
+
+/**
+ * @brief Representation of an arena
+ *
+ */
+typedef struct Arena {
+  ArenaBlock* blocks;  // newest block, which allocations are bumped out of
+  size_t blockSize;    // bytes of data in the next block allocated
+} Arena;
+
+/**
+ * @brief Constructs an empty arena, which allocates its first block on first
+ * use
+ *
+ * @param blockSize minimum bytes of data in each block
+ * @return Arena constructed, empty Arena
+ */
+Arena arena_construct(const size_t blockSize);
+
+/**
+ * @brief Allocates size bytes, aligned for any type, from arena. Adds a block
+ * of at least twice the size of the newest block when it's full. Sets errno
+ * upon error.
+ *
+ * @param arena arena to allocate from
+ * @param size number of bytes to allocate
+ * @return void* allocated memory or NULL upon error
+ */
+void* arena_alloc(Arena* const arena, const size_t size);
+
+/**
+ * @brief Grows an allocation of arena from oldSize to newSize bytes, in place
+ * when it's the newest allocation and its block has room, or by copying it
+ * into a new allocation otherwise. Sets errno upon error.
+ *
+ * @param arena arena ptr was allocated from
+ * @param ptr allocation to grow, or NULL to allocate
+ * @param oldSize current bytes of ptr
+ * @param newSize bytes ptr should hold
+ * @return void* grown allocation or NULL upon error, leaving ptr valid
+ */
+void* arena_grow(Arena* const arena, void* const ptr, const size_t oldSize,
+                 const size_t newSize);
+
+/**
+ * @brief Releases every allocation of arena. Keeps only the newest, largest
+ * block for reuse, so resetting an arena that fit in one block is O(1).
+ *
+ * @param arena arena to reset
+ */
+void arena_reset(Arena* const arena);
+
+/**
+ * @brief Frees every block of the provided arena. Does nothing if the
+ * provided Arena is NULL.
+ *
+ * @param arena arena to free
+ */
+void arena_freeData(Arena* const arena);
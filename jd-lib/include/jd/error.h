@@ -15,6 +15,36 @@
 
 #define ECMDNOTFOUND 127
 
+/**
+ * @brief Status returned by value from fast-path functions. They neither print
+ * nor touch errno, so callers branch on the returned status instead of
+ * resetting and re-checking errno around each call.
+ *
+ */
+typedef struct JdStatus {
+  int error;  // 0 upon success, otherwise a Unix error number
+} JdStatus;
+
+/**
+ * @brief Constructs a status from a Unix error number
+ *
+ * @param error 0 for success, otherwise a Unix error number
+ * @return JdStatus constructed status
+ */
+static inline JdStatus jd_status(const int error) {
+  const JdStatus status = {.error = error};
+  return status;
+}
+
+/**
+ * @brief Indicates whether status represents success
+ *
+ * @param status status to check
+ * @return true status holds no error
+ * @return false status holds an error
+ */
+static inline bool jd_ok(const JdStatus status) { return status.error == 0; }
+
 /**
  * @brief Prints error number and associated Unix error message, from strerror,
  * or a message indicating errorNumber is unknown to strerror
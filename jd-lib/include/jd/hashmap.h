@@ -0,0 +1,291 @@
+#pragma once
+/**
+ * @file hashmap.h
+ * @author Justen Di Ruscio
+ * @brief Declarations for an open addressing hash map. Slots are split into
+ * groups of HASHMAP_GROUP_WIDTH, each with a control byte holding 7 bits of
+ * its key's hash, so a probe compares a whole group of control bytes at once
+ * (with SSE2 when available) and only compares keys whose hash bits match.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>  // bool, true, false
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint8_t, uint64_t
+
+// slots whose control bytes are compared at once; capacities are multiples
+#define HASHMAP_GROUP_WIDTH 16
+
+/**
+ * @brief Hashes the keySize bytes of key. Must be well mixed in every bit.
+ *
+ */
+typedef uint64_t (*HashMapHasher)(const void* const key, const size_t keySize);
+
+/**
+ * @brief Compares the keySize bytes of two keys for equality
+ *
+ */
+typedef bool (*HashMapKeyEquals)(const void* const key1, const void* const key2,
+                                 const size_t keySize);
+
+/**
+ * @brief Represents a hash map. Keys and values are copied into the map's
+ * slots, which are stored contiguously after their control bytes.
+ *
+ */
+typedef struct HashMap {
+  uint8_t* ctrl;        // control byte per slot; hash bits, empty or deleted
+  void* slots;          // key then value of each slot
+  size_t capacity;      // num. slots; 0 or a power of 2 >= HASHMAP_GROUP_WIDTH
+  size_t length;        // num. keys
+  size_t growthLeft;    // num. keys insertable before rehashing
+  size_t keySize;       // size of each key (bytes)
+  size_t valueSize;     // size of each value (bytes); 0 for a set
+  size_t valueOffset;   // offset of value in each slot (bytes)
+  size_t slotSize;      // size of each slot (bytes)
+  HashMapHasher hasher;
+  HashMapKeyEquals keyEquals;
+} HashMap;
+
+/**
+ * @brief Used to return a hash map and a flag representing if the hash map is
+ * valid from functions that return a hash map and a possible error.
+ *
+ */
+typedef struct OptionalHashMap {
+  HashMap data;
+  bool valid;
+} OptionalHashMap;
+
+/**
+ * @brief Creates a completely empty hash map, which allocates on first insert
+ *
+ * @param keySize size of keys contained by the hash map to construct
+ * @param valueSize size of values contained by the hash map to construct
+ * @param hasher function hashing keys, or NULL to use hashMap_hashBytes
+ * @param keyEquals function comparing keys, or NULL to use hashMap_equalsBytes
+ * @return HashMap constructed, empty HashMap
+ */
+HashMap hashMap_constructEmpty(const size_t keySize, const size_t valueSize,
+                               const HashMapHasher hasher,
+                               const HashMapKeyEquals keyEquals);
+
+/**
+ * @brief Creates a hash map with room for capacity keys before it rehashes,
+ * allocated on the heap. Sets errno if result is invalid
+ *
+ * @param capacity number of keys to initially make room for
+ * @param keySize size of keys contained by the hash map to construct
+ * @param valueSize size of values contained by the hash map to construct
+ * @param hasher function hashing keys, or NULL to use hashMap_hashBytes
+ * @param keyEquals function comparing keys, or NULL to use hashMap_equalsBytes
+ * @return OptionalHashMap contains the constructed hash map and a flag to
+ * indicate its validity
+ */
+OptionalHashMap hashMap_constructCapacity(const size_t capacity,
+                                          const size_t keySize,
+                                          const size_t valueSize,
+                                          const HashMapHasher hasher,
+                                          const HashMapKeyEquals keyEquals);
+
+/**
+ * @brief Frees the contents of the provided hash map. Performs no action if
+ * map is NULL
+ *
+ * @param map HashMap who's contents were allocated on the heap
+ */
+void hashMap_freeData(const HashMap* const map);
+
+/**
+ * @brief Returns a pointer to the value of key in map, which stays valid until
+ * map is next modified. Returns NULL if key isn't in map or upon error, where
+ * errno is set upon error.
+ *
+ * @param map HashMap to find key in
+ * @param key pointer to key to find
+ * @return void* pointer to value of key or NULL
+ */
+void* hashMap_find(const HashMap* const map, const void* const key);
+
+/**
+ * @brief Indicates whether key is in map. Sets errno upon error.
+ *
+ * @param map HashMap to find key in
+ * @param key pointer to key to find
+ * @return true key is in map
+ * @return false key isn't in map or an error occurred
+ */
+bool hashMap_contains(const HashMap* const map, const void* const key);
+
+/**
+ * @brief Inserts a copy of key with a copy of value into map, or assigns value
+ * to key if key is already in map. Rehashes into twice the capacity when map
+ * is 7/8 full. Sets errno upon error.
+ *
+ * @param map HashMap to insert into
+ * @param key pointer to key to insert
+ * @param value pointer to value to copy, or NULL when valueSize is 0
+ * @return true successfully inserted or assigned key
+ * @return false failed to insert key
+ */
+bool hashMap_insert(HashMap* const map, const void* const key,
+                    const void* const value);
+
+/**
+ * @brief Erases key and its value from map. Sets errno upon error.
+ *
+ * @param map HashMap to erase key from
+ * @param key pointer to key to erase
+ * @return true successfully erased key
+ * @return false key wasn't in map or an error occurred
+ */
+bool hashMap_erase(HashMap* const map, const void* const key);
+
+/**
+ * @brief Reserves enough capacity in map to contain numKeys keys without
+ * rehashing. Does nothing if map is already large enough. Sets errno upon
+ * error.
+ *
+ * @param map HashMap upon which data is reserved
+ * @param numKeys number of keys map should hold without rehashing
+ * @return true successfully reserved memory
+ * @return false failed to reserve memory
+ */
+bool hashMap_reserve(HashMap* const map, const size_t numKeys);
+
+/**
+ * @brief Erases every key of map. Doesn't free any memory.
+ *
+ * @param map HashMap to clear
+ */
+void hashMap_clear(HashMap* const map);
+
+/**
+ * @brief Finds the first slot of map at or after slot which holds a key. Used
+ * to iterate over map in slot order:
+ * for (size_t s = hashMap_nextSlot(map, 0); s < map->capacity;
+ *      s = hashMap_nextSlot(map, s + 1))
+ *
+ * @param map HashMap to iterate over
+ * @param slot first slot to check
+ * @return size_t index of the found slot, or map->capacity if there's none
+ */
+size_t hashMap_nextSlot(const HashMap* const map, const size_t slot);
+
+/**
+ * @brief Accesses the key in slot of map, as found by hashMap_nextSlot
+ *
+ * @param map HashMap to access
+ * @param slot index of a slot holding a key
+ * @return void* pointer to the key
+ */
+void* hashMap_keyAt(const HashMap* const map, const size_t slot);
+
+/**
+ * @brief Accesses the value in slot of map, as found by hashMap_nextSlot
+ *
+ * @param map HashMap to access
+ * @param slot index of a slot holding a key
+ * @return void* pointer to the value
+ */
+void* hashMap_valueAt(const HashMap* const map, const size_t slot);
+
+/**
+ * @brief Default hasher; mixes every byte of key
+ *
+ * @param key pointer to key to hash
+ * @param keySize size of key (bytes)
+ * @return uint64_t hash of key
+ */
+uint64_t hashMap_hashBytes(const void* const key, const size_t keySize);
+
+/**
+ * @brief Default key comparison; compares every byte of the keys
+ *
+ * @param key1 pointer to first key
+ * @param key2 pointer to second key
+ * @param keySize size of keys (bytes)
+ * @return true keys are equal
+ * @return false keys differ
+ */
+bool hashMap_equalsBytes(const void* const key1, const void* const key2,
+                         const size_t keySize);
+
+/**
+ * @brief Hasher for keys of type const char*, hashing the null terminated
+ * chars pointed to rather than the pointer
+ *
+ * @param key pointer to a const char*
+ * @param keySize sizeof(const char*)
+ * @return uint64_t hash of the chars
+ */
+uint64_t hashMap_hashCString(const void* const key, const size_t keySize);
+
+/**
+ * @brief Key comparison for keys of type const char*, comparing the null
+ * terminated chars pointed to rather than the pointers
+ *
+ * @param key1 pointer to first const char*
+ * @param key2 pointer to second const char*
+ * @param keySize sizeof(const char*)
+ * @return true chars are equal
+ * @return false chars differ
+ */
+bool hashMap_equalsCString(const void* const key1, const void* const key2,
+                           const size_t keySize);
+
+/**
+ * @brief Declares a typed wrapper around HashMap, named typeName, with
+ * functions prefixed by prefix, mapping keys of type keyType to values of type
+ * valueType. For instance, HASHMAP_DECLARE_TYPED(PidMap, pidMap, pid_t,
+ * size_t, NULL, NULL) declares PidMap and pidMap_insert(map, pid, index).
+ * hasher and keyEquals are as in hashMap_constructEmpty.
+ *
+ */
+#define HASHMAP_DECLARE_TYPED(typeName, prefix, keyType, valueType, hasher,  \
+                              keyEquals)                                     \
+  typedef struct typeName {                                                  \
+    HashMap map;                                                             \
+  } typeName;                                                                \
+                                                                             \
+  static inline typeName prefix##_constructEmpty(void) {                     \
+    typeName typed = {.map = hashMap_constructEmpty(                         \
+                          sizeof(keyType), sizeof(valueType), hasher,        \
+                          keyEquals)};                                       \
+    return typed;                                                            \
+  }                                                                          \
+                                                                             \
+  static inline void prefix##_freeData(const typeName* const typed) {        \
+    hashMap_freeData(&typed->map);                                           \
+  }                                                                          \
+                                                                             \
+  static inline valueType* prefix##_find(const typeName* const typed,        \
+                                         keyType key) {                \
+    return (valueType*)hashMap_find(&typed->map, &key);                      \
+  }                                                                          \
+                                                                             \
+  static inline bool prefix##_contains(const typeName* const typed,          \
+                                       keyType key) {                  \
+    return hashMap_contains(&typed->map, &key);                              \
+  }                                                                          \
+                                                                             \
+  static inline bool prefix##_insert(typeName* const typed,                  \
+                                     keyType key,                      \
+                                     valueType value) {                \
+    return hashMap_insert(&typed->map, &key, &value);                        \
+  }                                                                          \
+                                                                             \
+  static inline bool prefix##_erase(typeName* const typed,                   \
+                                    keyType key) {                     \
+    return hashMap_erase(&typed->map, &key);                                 \
+  }                                                                          \
+                                                                             \
+  static inline bool prefix##_reserve(typeName* const typed,                 \
+                                      const size_t numKeys) {                \
+    return hashMap_reserve(&typed->map, numKeys);                            \
+  }
@@ -0,0 +1,144 @@
+#pragma once
+/**
+ * @file instrument.h
+ * @author Justen Di Ruscio
+ * @brief Declarations for runtime metrics of jd-lib: counters kept per thread
+ * and summed on read, and trace spans written as Chrome trace events, which
+ * chrome://tracing and Perfetto open. jd-lib only records them when built
+ * with JD_INSTRUMENT defined (the JD_INSTRUMENT CMake option); otherwise the
+ * JD_COUNT and JD_TRACE macros expand to nothing.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint64_t
+
+/**
+ * @brief Metrics counted by jd-lib
+ *
+ */
+typedef enum JdCounter {
+  jd_counterTasksEnqueued,      // tasks given to a thread pool
+  jd_counterTasksRun,           // task runs finished by thread pools
+  jd_counterTaskWaitNs,         // summed enqueue to start time of task runs
+  jd_counterTaskRunNs,          // summed run time of tasks
+  jd_counterQueueDepthPeak,     // most tasks waiting in a pool's waitingTasks
+  jd_counterAllocations,        // heap allocations by containers and pools
+  jd_counterAllocatedBytes,     // bytes of those allocations
+  jd_counterTaskMutexLocks,     // acquisitions of a pool's taskMutex
+  jd_counterTaskMutexContended, // acquisitions that found it already held
+  jd_counterTaskMutexWaitNs,    // summed time blocked on it when contended
+  jd_numCounters
+} JdCounter;
+
+/**
+ * @brief Adds amount to the calling thread's count of counter
+ *
+ * @param counter counter to add to
+ * @param amount amount to add
+ */
+void jd_counterAdd(const JdCounter counter, const uint64_t amount);
+
+/**
+ * @brief Raises the calling thread's value of counter to value, if greater.
+ * Reading such a counter gives the maximum over every thread.
+ *
+ * @param counter counter to raise
+ * @param value candidate maximum
+ */
+void jd_counterMax(const JdCounter counter, const uint64_t value);
+
+/**
+ * @brief Reads counter, merged over every thread that ever counted it,
+ * including threads that have exited. Concurrent counts may be missed.
+ *
+ * @param counter counter to read
+ * @return uint64_t sum, or maximum for jd_counterQueueDepthPeak
+ */
+uint64_t jd_counterRead(const JdCounter counter);
+
+/**
+ * @brief Name of counter, for reports
+ *
+ * @param counter counter to name
+ * @return const char* name of counter
+ */
+const char *jd_counterName(const JdCounter counter);
+
+/**
+ * @brief Starts writing trace events to the file at path, replacing it. Events
+ * are buffered per thread, and written when a thread's buffer fills, when it
+ * exits, or when tracing stops. Stops any trace already started. Sets errno
+ * upon error.
+ *
+ * @param path file to write Chrome trace events to
+ * @return true successfully opened path
+ * @return false failed to open path
+ */
+bool jd_traceStart(const char *const path);
+
+/**
+ * @brief Writes every thread's buffered events, then finishes and closes the
+ * trace file. Spans still open are dropped.
+ *
+ */
+void jd_traceStop(void);
+
+/**
+ * @brief Open trace span, closed by jd_traceEnd
+ *
+ */
+typedef struct JdTraceSpan {
+  const char *name;
+  uint64_t startNs;
+} JdTraceSpan;
+
+/**
+ * @brief Opens a span named name on the calling thread
+ *
+ * @param name static string naming the span
+ * @return JdTraceSpan span to pass to jd_traceEnd
+ */
+JdTraceSpan jd_traceBegin(const char *const name);
+
+/**
+ * @brief Closes span, buffering it as a complete event if tracing
+ *
+ * @param span span opened by jd_traceBegin
+ */
+void jd_traceEnd(const JdTraceSpan *const span);
+
+/**
+ * @brief Buffers a sample of a value over time, drawn as a graph by trace
+ * viewers, if tracing
+ *
+ * @param name static string naming the value
+ * @param value value at this time
+ */
+void jd_traceValue(const char *const name, const uint64_t value);
+
+#if defined(JD_INSTRUMENT)
+#define JD_COUNT(counter, amount) jd_counterAdd((counter), (amount))
+#define JD_COUNT_MAX(counter, value) jd_counterMax((counter), (value))
+#define JD_COUNT_ALLOCATION(bytes)                    \
+  do {                                                \
+    jd_counterAdd(jd_counterAllocations, 1);          \
+    jd_counterAdd(jd_counterAllocatedBytes, (bytes)); \
+  } while (0)
+#define JD_TRACE_VALUE(name, value) jd_traceValue((name), (value))
+// opens a span closed when the enclosing block exits, by any path; at most
+// one per block
+#define JD_TRACE_SCOPE(name)                                         \
+  const JdTraceSpan jdTraceScope                                     \
+      __attribute__((cleanup(jd_traceEnd), unused)) = jd_traceBegin(name)
+#else
+#define JD_COUNT(counter, amount) ((void)0)
+#define JD_COUNT_MAX(counter, value) ((void)0)
+#define JD_COUNT_ALLOCATION(bytes) ((void)0)
+#define JD_TRACE_VALUE(name, value) ((void)0)
+#define JD_TRACE_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,184 @@
+#pragma once
+/**
+ * @file priority_queue.h
+ * @author Justen Di Ruscio
+ * @brief Declarations for a priority queue stored as an array backed d-ary
+ * heap. Each element is given a handle on push, through which it can be
+ * accessed, reprioritized or erased in O(log n) wherever it moved in the heap.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>  // bool, true, false
+#include <stddef.h>   // size_t
+
+// children of each heap node; 4 keeps a node's children in one cache line for
+// small elements and halves the depth of a binary heap
+#define PQ_ARITY 4
+
+/**
+ * @brief Orders elements of a priority queue
+ *
+ * @return int < 0 when element1 comes out before element2, > 0 when after and
+ * 0 when either may come out first
+ */
+typedef int (*PriorityQueueCompare)(const void* const element1,
+                                    const void* const element2);
+
+/**
+ * @brief Identifies an element of a priority queue for as long as it's in the
+ * priority queue. Handles of popped or erased elements are reused.
+ *
+ */
+typedef size_t PriorityQueueHandle;
+
+/**
+ * @brief Represents a priority queue
+ *
+ */
+typedef struct PriorityQueue {
+  void* elements;      // heap ordered, followed by one element of scratch space
+  size_t* handles;     // handle of the element at each heap position
+  size_t* positions;   // heap position of each handle, or next free handle
+  size_t length;       // num. elements
+  size_t capacity;     // num. possible elements and handles
+  size_t numHandles;   // num. handles ever given out
+  size_t freeHandles;  // first free handle, if any
+  size_t dataSize;     // size of each element (bytes)
+  PriorityQueueCompare compare;
+} PriorityQueue;
+
+/**
+ * @brief Creates a completely empty priority queue, which allocates on first
+ * push
+ *
+ * @param dataSize size of elements contained by the priority queue
+ * @param compare function ordering elements; the least comes out first
+ * @return PriorityQueue constructed, empty PriorityQueue
+ */
+PriorityQueue pq_constructEmpty(const size_t dataSize,
+                                const PriorityQueueCompare compare);
+
+/**
+ * @brief Frees the contents of the provided priority queue. Performs no action
+ * if pq is NULL
+ *
+ * @param pq PriorityQueue who's contents were allocated on the heap
+ */
+void pq_freeData(const PriorityQueue* const pq);
+
+/**
+ * @brief Reserves enough capacity in pq to contain numElements elements. Does
+ * nothing if pq is already large enough. Sets errno upon error.
+ *
+ * @param pq PriorityQueue upon which data is reserved
+ * @param numElements number of elements pq should hold after reservation
+ * @return true successfully reserved memory
+ * @return false failed to reserve memory
+ */
+bool pq_reserve(PriorityQueue* const pq, const size_t numElements);
+
+/**
+ * @brief Adds a copy of element to pq in O(log n). Sets errno upon error.
+ *
+ * @param pq PriorityQueue to push onto
+ * @param element pointer to data to copy into pq
+ * @param handle assigned the handle of the pushed element, unless NULL
+ * @return true successfully pushed element
+ * @return false failed to push element
+ */
+bool pq_push(PriorityQueue* const pq, const void* const element,
+             PriorityQueueHandle* const handle);
+
+/**
+ * @brief Accesses the element of pq which comes out first. Sets errno on error
+ * and returns NULL, like if pq is empty.
+ *
+ * @param pq PriorityQueue to access
+ * @return void* pointer to the first element, valid until pq is modified
+ */
+void* pq_top(const PriorityQueue* const pq);
+
+/**
+ * @brief Accesses the handle of the element of pq which comes out first. Sets
+ * errno on error, like if pq is empty.
+ *
+ * @param pq PriorityQueue to access
+ * @param handle assigned the handle of the first element
+ * @return true successfully accessed handle
+ * @return false pq is empty or an error occurred
+ */
+bool pq_topHandle(const PriorityQueue* const pq,
+                  PriorityQueueHandle* const handle);
+
+/**
+ * @brief Removes the element of pq which comes out first in O(log n). Sets
+ * errno upon error, like if pq is empty.
+ *
+ * @param pq PriorityQueue to pop from
+ * @param element assigned a copy of the popped element, unless NULL
+ * @return true successfully popped element
+ * @return false failed to pop element
+ */
+bool pq_pop(PriorityQueue* const pq, void* const element);
+
+/**
+ * @brief Accesses the element of pq identified by handle. Sets errno on error
+ * and returns NULL, like if handle isn't in pq.
+ *
+ * @param pq PriorityQueue to access
+ * @param handle handle of the element to access
+ * @return void* pointer to the element, valid until pq is modified. Mustn't
+ * be modified in a way that changes its order; use pq_update instead
+ */
+void* pq_at(const PriorityQueue* const pq, const PriorityQueueHandle handle);
+
+/**
+ * @brief Indicates whether handle identifies an element of pq
+ *
+ * @param pq PriorityQueue to check
+ * @param handle handle to check
+ * @return true handle identifies an element of pq
+ * @return false handle was never given out, or its element was popped or
+ * erased
+ */
+bool pq_contains(const PriorityQueue* const pq,
+                 const PriorityQueueHandle handle);
+
+/**
+ * @brief Assigns element to the element of pq identified by handle, moving it
+ * to its new place in pq in O(log n). Handles both raising and lowering the
+ * element's priority, so it doubles as decrease-key. Sets errno upon error.
+ *
+ * @param pq PriorityQueue to update
+ * @param handle handle of the element to update
+ * @param element pointer to data to copy into the element
+ * @return true successfully updated element
+ * @return false failed to update element
+ */
+bool pq_update(PriorityQueue* const pq, const PriorityQueueHandle handle,
+               const void* const element);
+
+/**
+ * @brief Removes the element of pq identified by handle in O(log n). Sets
+ * errno upon error.
+ *
+ * @param pq PriorityQueue to erase from
+ * @param handle handle of the element to erase
+ * @param element assigned a copy of the erased element, unless NULL
+ * @return true successfully erased element
+ * @return false failed to erase element
+ */
+bool pq_erase(PriorityQueue* const pq, const PriorityQueueHandle handle,
+              void* const element);
+
+/**
+ * @brief Number of elements in pq
+ *
+ * @param pq PriorityQueue to measure
+ * @return size_t num. elements
+ */
+size_t pq_length(const PriorityQueue* const pq);
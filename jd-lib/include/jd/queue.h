@@ -11,6 +11,7 @@
  */
 #pragma once
 
+#include <jd/error.h>
 #include <jd/list.h>
 
 typedef struct Queue {
@@ -23,6 +24,17 @@ void q_freeElements(Queue* const q);
 bool q_enqueue(Queue* const q, const void *const element);
 bool q_dequeue(Queue* const q);
 
+/**
+ * @brief Removes the front element of q, copying it to element, without
+ * setting errno or printing. The element's ownership moves to the caller, so
+ * q's elementDeleter isn't called on it unless element is NULL.
+ *
+ * @param q queue to pop from
+ * @param element where to copy the front element, or NULL to drop it
+ * @return JdStatus ENOENT if q is empty
+ */
+JdStatus q_tryPop(Queue* const q, void* const element);
+
 void* q_front(const Queue* const q);
 void* q_back(const Queue* const q);
 size_t q_length(const Queue* const q);
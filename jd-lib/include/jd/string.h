@@ -0,0 +1,335 @@
+#pragma once
+/**
+ * @file string.h
+ * @author Justen Di Ruscio (3624673)
+ * @brief Symbols for arbitrary length, null terminated strings and their
+ * manipulation. Strings shorter than STRING_SMALL_CAPACITY are stored inline
+ * in the String rather than on the heap. StringViews refer to chars owned by
+ * something else, without copying them.
+ * @version 0.1
+ * @date 2021-02-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <jd/error.h>
+#include <jd/vector.h>
+#include <string.h>
+
+struct Arena;  // defined in jd/arena.h
+
+// capacity of a String's inline buffer, including null termination
+#define STRING_SMALL_CAPACITY 16
+
+/**
+ * @brief Representation of a string. Its chars live in buffer.small while
+ * capacity is STRING_SMALL_CAPACITY, and in buffer.heap once it's larger, so
+ * they must be accessed through string_data or string_constData. Since small
+ * strings are stored by value, pointers to a String's chars are invalidated
+ * when the String is moved, like when a Vector of Strings grows.
+ *
+ */
+typedef struct String {
+  union {
+    char* heap;
+    char small[STRING_SMALL_CAPACITY];
+  } buffer;
+  size_t length;    // in bytes
+  size_t capacity;  // memory including null termination
+  // allocates buffer.heap instead of the heap when not NULL, in which case
+  // it's released with the arena rather than by string_freeData
+  struct Arena* arena;
+} String;
+
+/**
+ * @brief Non-owning reference to length chars, which aren't necessarily null
+ * terminated. Valid as long as the chars it refers to are.
+ *
+ */
+typedef struct StringView {
+  const char* data;
+  size_t length;  // in bytes
+} StringView;
+
+/**
+ * @brief Position of length chars within a String or StringView, as found by
+ * stringView_tokenize
+ *
+ */
+typedef struct StringSpan {
+  size_t offset;  // in bytes, from the start of the tokenized chars
+  size_t length;  // in bytes
+} StringSpan;
+
+/**
+ * @brief Contains a string and a flag to indicate its validity. Used to return
+ * a string and possibly an error from functions.
+ *
+ */
+typedef struct OptionalString {
+  String data;
+  bool valid;
+} OptionalString;
+
+/**
+ * @brief Constructs and empty string by initializing the String struct. The
+ * empty String has STRING_SMALL_CAPACITY inline capacity and doesn't allocate.
+ *
+ * @return String constructed, empty String
+ */
+String string_constructEmpty();
+
+/**
+ * @brief Constructs a String with an initial capacity, only allocating when
+ * it exceeds STRING_SMALL_CAPACITY. Sets errno upon error.
+ *
+ * @param capacity number of chars to reserve in String's initial capacity
+ * @return OptionalString constructed String and flag to indicate validity of
+ * the String
+ */
+OptionalString string_constructCapacity(const size_t capacity);
+
+/**
+ * @brief Constructs a String with an initial capacity, as
+ * string_constructCapacity does, but allocating from arena. Sets errno upon
+ * error.
+ *
+ * @param capacity number of chars to reserve in String's initial capacity
+ * @param arena arena to allocate from, or NULL to allocate on the heap
+ * @return OptionalString constructed String and flag to indicate validity of
+ * the String
+ */
+OptionalString string_constructCapacityArena(const size_t capacity,
+                                             struct Arena* const arena);
+
+/**
+ * @brief Constructs a String whose contents are copied from the other String.
+ * Sets errno upon error.
+ *
+ * @param other String to copy contents of
+ * @return OptionalString constructed string and flag to indicate validity of
+ * the String
+ */
+OptionalString string_copyConstruct(const String* const other);
+
+/**
+ * @brief Constructs a String whose contents are copied from the null terminated
+ * bytes pointed to by other. Sets errno upon error.
+ *
+ * @param other c-style string (null-terminated array) to copy contents of
+ * @return OptionalString constructed string and flag to indicate validity of
+ * the String
+ */
+OptionalString string_copyConstructChar(const char* const other);
+
+/**
+ * @brief Constructs a String whose contents are copied from the chars
+ * referred to by view. Sets errno upon error.
+ *
+ * @param view chars to copy
+ * @return OptionalString constructed string and flag to indicate validity of
+ * the String
+ */
+OptionalString string_constructView(const StringView view);
+
+/**
+ * @brief Constructs a String whose contents are copied from the chars
+ * referred to by view, allocating from arena. Sets errno upon error.
+ *
+ * @param view chars to copy
+ * @param arena arena to allocate from, or NULL to allocate on the heap
+ * @return OptionalString constructed string and flag to indicate validity of
+ * the String
+ */
+OptionalString string_constructViewArena(const StringView view,
+                                         struct Arena* const arena);
+
+/**
+ * @brief Null terminated chars of the provided String, which may be written
+ * up to its capacity
+ *
+ * @param str String to access
+ * @return char* str's chars
+ */
+char* string_data(String* const str);
+
+/**
+ * @brief Null terminated chars of the provided String, for reading
+ *
+ * @param str String to access
+ * @return const char* str's chars
+ */
+const char* string_constData(const String* const str);
+
+/**
+ * @brief Frees the contents of the provided String. Does nothing if the
+ * provided String or its contents is NULL.
+ *
+ * @param str String to free contents of
+ */
+void string_freeData(const String* const str);
+
+/**
+ * @brief Calls string_freeData after casting str to a String. Provides a
+ * uniform interface for freeing String data.
+ *
+ * @param str String to free contents of
+ */
+void string_freeDataVoid(const void* const str);
+
+/**
+ * @brief Reserves enough memory in str to contain newCapacity chars. Does
+ * nothing if str is already large enough. Sets errno upon error.
+ *
+ * @param newCapacity number of chars str's buffer should hold after reserve
+ * @return true successfully reserved memory
+ * @return false failed to reserve memory
+ */
+bool string_reserve(String* const str, const size_t newCapacity);
+
+/**
+ * @brief Splits the provided string by any of the delimeters pointed to by
+ * delim into a Vector of Strings. Resulting Strings own their memory; they
+ * don't point to contents of str, which is left unmodified. Sets errno upon
+ * error.
+ *
+ * @param str String to split
+ * @param delim null-terminated list of chars used as delimeters to split str
+ * @return OptionalVector Vector of split Strings and a flag do indicate the
+ * validity of the operations.
+ */
+OptionalVector string_split(const String* const str, const char* const delim);
+
+/**
+ * @brief Compares contents of two strings with strcmp
+ *
+ * @param first String
+ * @param second String
+ * @return int result of strcmp
+ */
+int string_compare(const String* const first, const String* const second);
+
+/**
+ * @brief Compares contents of first String with null-terminated c-style
+ * string, second using strcmp.
+ *
+ * @param first String
+ * @param second null-terminated c-style string
+ * @return int result of strcmp
+ */
+int string_compareChar(const String* const first, const char* const second);
+
+/**
+ * @brief Indicates if the provided String's contents contains the provided
+ * char. Sets errno upon error.
+ *
+ * @param string String to find char in
+ * @param element char to find in string
+ * @return true element is present in string
+ * @return false element is not present in string
+ */
+bool string_contains(const String* const string, const char element);
+
+/**
+ * @brief Strips any of the chars in delimeters from the start and end of
+ * string. Leaves string unmodified. Sets errno upon error
+ *
+ * @param string String to strip characters from
+ * @param delimeters String containing chars to strip from string
+ * @return OptionalString stripped string and flag to indicate the validity of
+ * the operations.
+ */
+OptionalString string_strip(const String* const string,
+                            const String* const delimeters);
+
+/**
+ * @brief View of all of the provided String's chars
+ *
+ * @param str String to view
+ * @return StringView view of str, invalidated when str is modified or moved
+ */
+StringView string_view(const String* const str);
+
+/**
+ * @brief View of the provided null-terminated chars
+ *
+ * @param chars c-style string to view
+ * @return StringView view of chars, excluding the null termination
+ */
+StringView stringView_fromChar(const char* const chars);
+
+/**
+ * @brief Indicates if the chars referred to by view contain the provided char
+ *
+ * @param view chars to find element in
+ * @param element char to find
+ * @return true element is present in view
+ * @return false element is not present in view
+ */
+bool stringView_contains(const StringView view, const char element);
+
+/**
+ * @brief Narrows view to exclude any of the chars in delimeters from its start
+ * and end. Doesn't copy or allocate.
+ *
+ * @param view chars to strip
+ * @param delimeters chars to strip from view
+ * @return StringView stripped view into the same chars as view
+ */
+StringView stringView_strip(const StringView view,
+                            const StringView delimeters);
+
+/**
+ * @brief Finds the tokens of view separated by any of the chars in
+ * delimeters, writing the first maxSpans of them into spans. Neither modifies
+ * view nor allocates, and scans 16 chars at a time when SSE2 is available and
+ * there are at most 8 delimeters. Call with maxSpans of 0 to count tokens
+ * before providing room for them.
+ *
+ * @param view chars to tokenize
+ * @param delimeters chars separating tokens
+ * @param spans out-parameter receiving the tokens' positions within view; may
+ * be NULL when maxSpans is 0
+ * @param maxSpans number of spans there's room for
+ * @return size_t number of tokens in view, which may exceed maxSpans
+ */
+size_t stringView_tokenize(const StringView view, const StringView delimeters,
+                           StringSpan* const spans, const size_t maxSpans);
+
+/**
+ * @brief View of the chars of view covered by span
+ *
+ * @param view chars span was found in
+ * @param span position within view
+ * @return StringView view of span's chars
+ */
+StringView stringView_span(const StringView view, const StringSpan span);
+
+/**
+ * @brief Splits the chars referred to by view by any of the chars in
+ * delimeters into a Vector of Strings, as string_split does. Sets errno upon
+ * error.
+ *
+ * @param view chars to split
+ * @param delimeters chars separating the split Strings
+ * @return OptionalVector Vector of split Strings and a flag do indicate the
+ * validity of the operations.
+ */
+OptionalVector stringView_split(const StringView view,
+                                const StringView delimeters);
+
+/**
+ * @brief Splits the chars referred to by view, as stringView_split does, but
+ * allocates the Vector and every String from arena, so the whole result is
+ * released with the arena. Sets errno upon error.
+ *
+ * @param view chars to split
+ * @param delimeters chars separating the split Strings
+ * @param arena arena to allocate from, or NULL to allocate on the heap
+ * @return OptionalVector Vector of split Strings and a flag do indicate the
+ * validity of the operations.
+ */
+OptionalVector stringView_splitArena(const StringView view,
+                                     const StringView delimeters,
+                                     struct Arena* const arena);
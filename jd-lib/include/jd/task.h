@@ -0,0 +1,188 @@
+#pragma once
+/**
+ * @file task.h
+ * @author Justen Di Ruscio
+ * @brief Declarations of Task abstraction
+ * @version 0.1
+ * @date 2021-03-20
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct ThreadPool; // defined in jd/threadpool.h, which includes this header
+
+/**
+ * @brief Values of a Task's state, which doubles as the futex word waiters of
+ * task_getResult sleep on
+ *
+ */
+typedef enum TaskState {
+  task_Pending, // not completed and nobody is sleeping on it
+  task_Waiting, // not completed and at least one thread may be sleeping on it
+  task_Completed
+} TaskState;
+
+/**
+ * @brief Intrusive node of a Task's list of continuations. run is called once
+ * by the thread that completes the Task, and may free the node.
+ *
+ */
+typedef struct TaskContinuation {
+  struct TaskContinuation *next;
+  void (*run)(struct TaskContinuation *self);
+} TaskContinuation;
+
+// Encapsulates a packaged task and a future but can also encapsulate a promise
+// and a future if foo does nothing, because the task is marked completed
+// independently of running foo
+typedef struct Task {
+  void *(*foo)(void *);
+  void *fooArg;
+  void **fooReturn;
+  int fooErrno;
+  atomic_uint state; // TaskState; read through task_isCompleted
+  // pushed by task_then, task_whenAll and task_whenAny, and closed on completion
+  _Atomic(TaskContinuation *) continuations;
+  // links this task into an antecedent's continuations through task_then
+  TaskContinuation thenNode;
+  struct ThreadPool *thenPool;
+  uint64_t enqueuedNs; // monotonic time set by the thread pool on enqueue
+  // delayed and periodic scheduling, managed by the thread pool
+  unsigned periodMs;       // 0 unless periodic
+  atomic_bool cancelled;   // set by task_cancel
+  uint64_t timerExpiry;    // tick to run at
+  // link in whichever of a thread pool's waiting queue, timer wheel slot or
+  // freelist currently holds the task
+  struct Task *next;
+  atomic_uint ownership; // tp_releaseTask bookkeeping, managed by the pool
+} Task;
+
+// bit of a Task's ownership set by a thread pool from letting go of the task
+// until it stops touching it, after marking it completed
+#define TASK_OWNERSHIP_FINISHING 4u
+// bit of a Task's ownership set while FINISHING by threads that may be
+// sleeping on the ownership word in task_awaitPool
+#define TASK_OWNERSHIP_AWAITED 8u
+
+
+int task_init(Task *const task, void *(*foo)(void *), void *fooArg,
+                void **fooReturn);
+
+int task_destroy(Task *const task);
+
+/**
+ * @brief executes foo with fooArg but doesn't mark task completed
+ *
+ * @param task
+ * @return int
+ */
+int task_execute(Task* const task);
+
+/**
+ * @brief Marks the task as completed, waking threads blocked in
+ * task_getResult and releasing its continuations. Marking an already completed
+ * task does nothing.
+ *
+ * @param task task to mark completed
+ * @return int errno
+ */
+int task_markCompleted(Task*const task);
+
+/**
+ * @brief Indicates whether the task has been marked completed, without
+ * blocking
+ *
+ * @param task task to check
+ * @return true task is completed
+ * @return false task is still pending
+ */
+bool task_isCompleted(const Task *const task);
+
+/**
+ * @brief Runs continuation once antecedent completes: enqueued into tp, or
+ * executed and marked completed on the thread completing antecedent when tp
+ * is NULL. Runs immediately when antecedent already completed. When it can't
+ * be enqueued then, continuation is completed without running, with the error
+ * as its fooErrno. A task can only be the continuation of one antecedent at a
+ * time; to read antecedent's result, point continuation's fooArg at
+ * antecedent. Sets errno upon error.
+ *
+ * @param antecedent task to wait on
+ * @param continuation initialized task to run after antecedent
+ * @param tp thread pool to run continuation in, or NULL to run it inline
+ * @return int errno
+ */
+int task_then(Task *const antecedent, Task *const continuation,
+              struct ThreadPool *const tp);
+
+/**
+ * @brief Runs continuation, as in task_then, once every one of tasks has
+ * completed. Sets errno upon error.
+ *
+ * @param tasks tasks to wait on
+ * @param numTasks number of tasks
+ * @param continuation initialized task to run after all of tasks
+ * @param tp thread pool to run continuation in, or NULL to run it inline
+ * @return int errno
+ */
+int task_whenAll(Task *const *const tasks, const size_t numTasks,
+                 Task *const continuation, struct ThreadPool *const tp);
+
+/**
+ * @brief Runs continuation, as in task_then, once the first of tasks
+ * completes. The remaining tasks must still complete eventually, since each
+ * holds a reference to the shared bookkeeping. Sets errno upon error.
+ *
+ * @param tasks tasks to wait on; must not be empty
+ * @param numTasks number of tasks
+ * @param continuation initialized task to run after any of tasks
+ * @param tp thread pool to run continuation in, or NULL to run it inline
+ * @return int errno
+ */
+int task_whenAny(Task *const *const tasks, const size_t numTasks,
+                 Task *const continuation, struct ThreadPool *const tp);
+
+/**
+ * @brief Stops a delayed or periodic task from running again. The thread pool
+ * marks it completed once it comes due or, when called during a run, once
+ * that run finishes, so it mustn't be marked completed by the caller.
+ *
+ * @param task task to cancel
+ * @return int errno
+ */
+int task_cancel(Task *const task);
+
+/**
+ * @brief Blocks until the thread pool completing task, if any, lets go of it.
+ * Sleeps on the task's ownership word with a futex, like task_getResult does
+ * on its state.
+ *
+ * @param task completed task
+ */
+void task_awaitPool(Task *const task);
+
+/**
+ * @brief Clears TASK_OWNERSHIP_FINISHING as a thread pool's last touch of
+ * task, waking the threads in task_awaitPool. Only called by the pool.
+ *
+ * @param task task the pool completed
+ */
+void task_letGo(Task *const task);
+
+/**
+ * @brief Blocks until foo completes and places result of foo in fooReturn,
+ * and until the thread pool that completed it let go of it, so it may be
+ * destroyed on return.
+ * Sleeps on the task's state with a futex rather than a condition variable.
+ * Avoid calling from a thread pool's threads; chain with task_then instead.
+ *
+ * @param task
+ * @return int
+ */
+int task_getResult(Task *const task);
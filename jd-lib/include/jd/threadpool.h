@@ -0,0 +1,250 @@
+#pragma once
+/**
+ * @file threadpool.h
+ * @author Justen Di Ruscio
+ * @brief Declarations for an expanding threadpool
+ * @version 0.1
+ * @date 2021-03-20
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <jd/queue.h>
+#include <jd/task.h>
+
+
+// the number of idle threads in threads are tacked such that enqueueImmediate
+// can immediately spawn a new thread if no idle threads are available. This is
+// to meet the requirements in the assignment, where multiple specific items
+// require their own thread, like each caterpillar. A normal thread pool
+// wouldn't have this functionality, but it's part of the assignment.
+
+// maximum number of workers a work-stealing pool can grow to
+#define TP_MAX_WORKERS 1024
+
+// size of the blocks handed out by tp_acquireTask
+#define TP_TASK_BLOCK_SIZE 256
+// most released blocks a pool keeps for reuse; blocks beyond this are freed
+#define TP_MAX_FREE_TASKS 1024
+
+/**
+ * @brief Scheduling strategy of a thread pool
+ *
+ */
+typedef enum ThreadPoolMode {
+  tp_SharedQueue, // every thread takes tasks from waitingTasks under taskMutex
+  tp_WorkStealing // every thread owns a deque and steals from the others
+} ThreadPoolMode;
+
+/**
+ * @brief Options to initialize a thread pool with through tp_initConfig
+ *
+ */
+typedef struct ThreadPoolConfig {
+  unsigned numInitThreads;
+  ThreadPoolMode mode;
+  unsigned minThreads;     // idle threads are never reaped below this count
+  unsigned maxThreads;     // 0 is unbounded; tasks wait once at the cap
+  unsigned idleTimeoutMs;  // idle time before a thread is reaped; 0 is never
+} ThreadPoolConfig;
+
+/**
+ * @brief Snapshot of a thread pool's counters, obtained through tp_getStats
+ *
+ */
+typedef struct ThreadPoolStats {
+  unsigned numThreads;       // threads currently alive
+  unsigned numIdleThreads;   // alive threads not running a task
+  unsigned peakThreads;      // most threads alive at once
+  size_t numPending;         // tasks in waitingTasks, not yet taken
+  size_t tasksCompleted;     // task runs finished, counting each periodic run
+  size_t threadsReaped;      // threads exited after idling idleTimeoutMs
+  uint64_t totalQueueWaitNs; // summed enqueue-to-start time of run tasks
+  uint64_t maxQueueWaitNs;   // longest enqueue-to-start time of a run task
+} ThreadPoolStats;
+
+/**
+ * @brief FIFO of Tasks linked through their next member, so that queueing a
+ * task never allocates
+ *
+ */
+typedef struct TaskQueue {
+  Task *head;
+  Task *tail;
+  size_t length;
+} TaskQueue;
+
+struct TpWorker;   // private per-thread state of a work-stealing pool
+struct TimerWheel; // private schedule of delayed and periodic tasks
+
+typedef struct ThreadPool {
+  Queue threads;
+  atomic_uint numIdleThreads;
+  pthread_cond_t taskAvailable;
+  pthread_mutex_t taskMutex;
+  TaskQueue waitingTasks; // tasks submitted from outside the pool
+  bool running;
+  ThreadPoolMode mode;
+  // bounds; protected by taskMutex except for numThreads being read lock-free
+  unsigned minThreads;
+  unsigned maxThreads;
+  unsigned idleTimeoutMs;
+  atomic_uint numThreads;
+  Queue exitedThreads; // reaped threads not yet joined
+  // statistics
+  atomic_uint peakThreads;
+  atomic_size_t tasksCompleted;
+  atomic_size_t threadsReaped;
+  atomic_uint_least64_t totalQueueWaitNs;
+  atomic_uint_least64_t maxQueueWaitNs;
+  // delayed and periodic tasks, run by a timer thread started on first use
+  struct TimerWheel *timers;
+  pthread_t timerThread;
+  bool timerRunning;
+  bool timerStopped;      // set by tp_destroy, after which nothing is scheduled
+  uint64_t timerWakeTick; // tick the timer thread sleeps until
+  pthread_mutex_t timerMutex;
+  pthread_cond_t timersChanged;
+  // released task blocks, linked through next, reused by tp_acquireTask
+  pthread_mutex_t freeTasksMutex;
+  Task *freeTasks;
+  size_t numFreeTasks;
+  // work-stealing mode only
+  struct TpWorker **workers;
+  atomic_uint numWorkers;
+  atomic_uint numSleeping;
+  atomic_uint numDequeTasks; // pushed onto workers' deques, not yet taken
+} ThreadPool;
+
+/**
+ * @brief Default configuration of a thread pool: a shared queue with no
+ * initial threads, no thread limit and no reaping of idle threads
+ *
+ * @return ThreadPoolConfig default configuration
+ */
+ThreadPoolConfig tp_defaultConfig();
+
+/**
+ * @brief initializes the thread pool. Non-re-entrant. errno set on error
+ *
+ * @param tp threadpool to initialize
+ * @param numInitThreads num thread to start thread pool with
+ * @return int errno
+ */
+int tp_init(ThreadPool *const tp, const unsigned numInitThreads);
+
+/**
+ * @brief initializes the thread pool with the provided configuration.
+ * Non-re-entrant. errno set on error.
+ *
+ * In tp_WorkStealing mode each thread owns a Chase-Lev deque. Tasks enqueued
+ * from one of the pool's own threads are pushed onto that thread's deque
+ * without locking and popped LIFO by it; idle threads steal FIFO from random
+ * victims. Tasks enqueued from other threads go through waitingTasks.
+ *
+ * At most maxThreads threads are ever alive; once there, tasks wait for a
+ * thread to become idle. Threads idle for idleTimeoutMs exit while more than
+ * minThreads remain. The pool starts with the greater of numInitThreads and
+ * minThreads threads. Sets errno to EINVAL when the bounds are inconsistent.
+ *
+ * @param tp threadpool to initialize
+ * @param config options to initialize tp with
+ * @return int errno
+ */
+int tp_initConfig(ThreadPool *const tp, const ThreadPoolConfig *const config);
+
+/**
+ * @brief destroys provided thread pool. Its threads finish the tasks already
+ * waiting before they're joined, while delayed and periodic tasks not yet due
+ * never run; they're completed with ECANCELED as their fooErrno instead, as
+ * are periodic tasks once their current run finishes. Must not be called
+ * from one of tp's tasks. errno set of error
+ *
+ * @param tp thread pool
+ * @return true success
+ * @return false fail
+ */
+bool tp_destroy(ThreadPool *const tp);
+
+/**
+ * @brief enqueues the provided task into the threadpool, running it immediately by spawning a therad if one is not available, thereby expanding the pool of threads by one. Once the pool holds maxThreads threads, the task instead waits until a thread is idle
+ *
+ * @param tp thread pool
+ * @param task task to enqueue
+ * @return int errno
+ */
+int tp_enqueueImmediate(ThreadPool *const tp, Task *const task);
+
+/**
+ * @brief Fills stats with a snapshot of the thread pool's counters. Counters
+ * are read individually, so they may be mutually inconsistent while tasks run.
+ * Sets errno upon error.
+ *
+ * @param tp thread pool
+ * @param stats out-parameter filled with tp's counters
+ * @return int errno
+ */
+int tp_getStats(ThreadPool *const tp, ThreadPoolStats *const stats);
+
+/**
+ * @brief enqueues the provided task to run once delayMs milliseconds from now.
+ * The task can be cancelled with task_cancel until it starts running.
+ * errno set on error
+ *
+ * @param tp thread pool
+ * @param task task to enqueue
+ * @param delayMs milliseconds to wait before running task
+ * @return int errno
+ */
+int tp_enqueueDelayed(ThreadPool *const tp, Task *const task,
+                      const unsigned delayMs);
+
+/**
+ * @brief enqueues the provided task to run delayMs milliseconds from now and
+ * every periodMs milliseconds after that, skipping runs it fell behind on. The
+ * task is only marked completed once stopped with task_cancel, which may be
+ * called from within the task. Each run should be short, since it occupies a
+ * thread of the pool. errno set on error
+ *
+ * @param tp thread pool
+ * @param task task to enqueue
+ * @param delayMs milliseconds to wait before the first run
+ * @param periodMs milliseconds between runs; must not be 0
+ * @return int errno
+ */
+int tp_enqueuePeriodic(ThreadPool *const tp, Task *const task,
+                       const unsigned delayMs, const unsigned periodMs);
+
+/**
+ * @brief Takes a block of TP_TASK_BLOCK_SIZE bytes from tp's freelist,
+ * allocating one when the freelist is empty. The block begins with a Task, so
+ * it can hold any struct of up to size bytes whose first member is the Task.
+ * The Task must be initialized with task_init before use. Sets errno upon
+ * error, including EINVAL when size exceeds TP_TASK_BLOCK_SIZE.
+ *
+ * @param tp thread pool
+ * @param size size of the struct beginning with the Task
+ * @return Task* uninitialized task or NULL upon error
+ */
+Task *tp_acquireTask(ThreadPool *const tp, const size_t size);
+
+/**
+ * @brief Returns a block obtained from tp_acquireTask to tp's freelist. When
+ * the task is still queued in or being run by tp, the block is only reused
+ * once tp finishes with it, so a task may release itself or be released by
+ * another thread while it runs. Released while tp marks it completed, this
+ * waits for tp to let go of it. Blocks past TP_MAX_FREE_TASKS are freed.
+ * Sets errno upon error.
+ *
+ * @param tp thread pool the task was acquired from
+ * @param task task to release
+ * @return int errno
+ */
+int tp_releaseTask(ThreadPool *const tp, Task *const task);
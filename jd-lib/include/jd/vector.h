@@ -11,10 +11,13 @@
  *
  */
 
+#include <assert.h>     // assert
 #include <stdbool.h>    // bool, true, false
 #include <stddef.h>     // size_t
 #include <sys/types.h>  // ssize_t
 
+struct Arena;  // defined in jd/arena.h
+
 /**
  * @brief Represents a vector
  *
@@ -26,6 +29,9 @@ typedef struct Vector {
   size_t dataSize;  // size of each element (bytes)
   void (*elementDeleter)(
       const void* const element);  // function to free element
+  // allocates data instead of the heap when not NULL, in which case data is
+  // released with the arena rather than by vector_freeData
+  struct Arena* arena;
 } Vector;
 
 /**
@@ -58,6 +64,20 @@ Vector vector_constructEmpty(const size_t dataSize);
 OptionalVector vector_constructCapacity(const size_t capacity,
                                         const size_t dataSize);
 
+/**
+ * @brief Creates a vector with an initial capacity, allocated from arena
+ * along with any memory it grows into. Sets errno if result is invalid
+ *
+ * @param capacity amount of memory to initially allocate in number of elements
+ * @param dataSize size of elements contained by the vector to construct
+ * @param arena arena to allocate from, or NULL to allocate on the heap
+ * @return OptionalVector contains the constructed vector and a flag to indicate
+ * its validity
+ */
+OptionalVector vector_constructCapacityArena(const size_t capacity,
+                                             const size_t dataSize,
+                                             struct Arena* const arena);
+
 /**
  * @brief Creates a new vector with contents allocated on the heap and with the
  * same elements as other. Sets errno if result is invalid
@@ -102,6 +122,22 @@ void vector_freeElements(const Vector* const vec);
  */
 void* vector_at(const Vector* const vec, const size_t index);
 
+/**
+ * @brief Returns a pointer to the element at index without checking
+ * arguments, setting errno or printing, for loops already bounded by the
+ * vector's length. Indexing out of bounds is undefined; it only asserts, so
+ * release builds, defining NDEBUG, compile the check out.
+ *
+ * @param vec Vector to access element of
+ * @param index index of element in vec to access, less than vec's length
+ * @return void* pointer to contained element
+ */
+static inline void* vector_atUnchecked(const Vector* const vec,
+                                       const size_t index) {
+  assert(vec != (Vector*)NULL && index < vec->length);
+  return (char*)vec->data + index * vec->dataSize;
+}
+
 /**
  * @brief Accesses the last element of vec by calling vector_at. Sets errno on
  * error and returns NULL, like if the vector is empty.
@@ -0,0 +1,169 @@
+/**
+ * @file arena.c
+ * @author Justen Di Ruscio
+ * @brief Definitions for a bump allocator
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <jd/arena.h>
+#include <jd/instrument.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>  // fprintf
+#include <stdlib.h> // malloc
+#include <string.h> // memcpy
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Rounds size up to the alignment of any type. Empty allocations are
+ * given a byte, so each allocation has a distinct address.
+ *
+ * @param size bytes requested
+ * @return size_t bytes to reserve
+ */
+static size_t arena_alignUp(const size_t size) {
+  const size_t alignment = _Alignof(max_align_t);
+  const size_t nonEmpty = size == 0 ? 1 : size;
+  return (nonEmpty + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Allocates a new newest block of arena, twice as large as the current
+ * newest block and large enough for size bytes. Sets errno upon error.
+ *
+ * @param arena arena to add a block to
+ * @param size aligned bytes the block must fit
+ * @return ArenaBlock* new block or NULL upon error
+ */
+static ArenaBlock *arena_addBlock(Arena *const arena, const size_t size) {
+  size_t capacity = arena->blockSize;
+  if (arena->blocks != (ArenaBlock *)NULL &&
+      2 * arena->blocks->capacity > capacity) {
+    capacity = 2 * arena->blocks->capacity;
+  }
+  if (size > capacity) {
+    capacity = size;
+  }
+
+  ArenaBlock *const block = malloc(sizeof(ArenaBlock) + capacity);
+  if (block == (ArenaBlock *)NULL) {
+    return block; // errno set by malloc
+  }
+  JD_COUNT_ALLOCATION(sizeof(ArenaBlock) + capacity);
+  block->next = arena->blocks;
+  block->capacity = capacity;
+  block->used = 0;
+  arena->blocks = block;
+  return block;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+Arena arena_construct(const size_t blockSize) {
+  Arena arena = {.blocks = (ArenaBlock *)NULL, .blockSize = blockSize};
+  return arena;
+}
+
+void *arena_alloc(Arena *const arena, const size_t size) {
+  const char fooName[] = "arena_alloc";
+
+  // Argument Validity Check
+  errno = 0;
+  if (arena == (Arena *)NULL) {
+    fprintf(stderr, "argument 'arena' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return NULL;
+  }
+
+  // Bump allocation out of the newest block, adding one when it's full
+  const size_t aligned = arena_alignUp(size);
+  ArenaBlock *block = arena->blocks;
+  if (block == (ArenaBlock *)NULL || block->capacity - block->used < aligned) {
+    block = arena_addBlock(arena, aligned);
+    if (block == (ArenaBlock *)NULL) {
+      fprintf(stderr, "Failure allocating arena block in %s\n", fooName);
+      return NULL; // errno set by arena_addBlock
+    }
+  }
+  void *const allocation = (char *)block->data + block->used;
+  block->used += aligned;
+  return allocation;
+}
+
+void *arena_grow(Arena *const arena, void *const ptr, const size_t oldSize,
+                 const size_t newSize) {
+  const char fooName[] = "arena_grow";
+
+  // Argument Validity Check
+  errno = 0;
+  if (arena == (Arena *)NULL) {
+    fprintf(stderr, "argument 'arena' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return NULL;
+  }
+  if (ptr == NULL) {
+    return arena_alloc(arena, newSize);
+  }
+  if (newSize <= oldSize) {
+    return ptr;
+  }
+
+  // Extend in place when ptr is the newest allocation of the newest block
+  ArenaBlock *const block = arena->blocks;
+  const size_t offset = (size_t)((char *)ptr - (char *)block->data);
+  const bool newest = (char *)ptr >= (char *)block->data &&
+                      offset + arena_alignUp(oldSize) == block->used;
+  if (newest && arena_alignUp(newSize) <= block->capacity - offset) {
+    block->used = offset + arena_alignUp(newSize);
+    return ptr;
+  }
+
+  // Otherwise copy into a new allocation; the old one is released on reset
+  void *const grown = arena_alloc(arena, newSize);
+  if (grown == NULL) {
+    fprintf(stderr, "Failure growing arena allocation in %s\n", fooName);
+    return grown; // errno set by arena_alloc
+  }
+  memcpy(grown, ptr, oldSize);
+  return grown;
+}
+
+void arena_reset(Arena *const arena) {
+  // Return if there's nothing to reset
+  if (arena == (Arena *)NULL || arena->blocks == (ArenaBlock *)NULL) {
+    return;
+  }
+
+  // Free older, smaller blocks and rewind the newest
+  ArenaBlock *block = arena->blocks->next;
+  while (block != (ArenaBlock *)NULL) {
+    ArenaBlock *const next = block->next;
+    free(block);
+    block = next;
+  }
+  arena->blocks->next = (ArenaBlock *)NULL;
+  arena->blocks->used = 0;
+}
+
+void arena_freeData(Arena *const arena) {
+  // Return if there's nothing to free
+  if (arena == (Arena *)NULL) {
+    return;
+  }
+
+  // Free every block
+  ArenaBlock *block = arena->blocks;
+  while (block != (ArenaBlock *)NULL) {
+    ArenaBlock *const next = block->next;
+    free(block);
+    block = next;
+  }
+  arena->blocks = (ArenaBlock *)NULL;
+}
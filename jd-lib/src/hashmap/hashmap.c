@@ -0,0 +1,589 @@
+/**
+ * @file hashmap.c
+ * @author Justen Di Ruscio
+ * @brief Definitions for an open addressing hash map with grouped control
+ * bytes
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <jd/hashmap.h>
+#include <jd/instrument.h>
+
+#include <errno.h>
+#include <stdio.h>  // fprintf
+#include <stdlib.h> // malloc
+#include <string.h> // memcpy, memcmp, memset, strcmp, strlen
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// control bytes of slots without a key; full slots hold 7 bits of hash, which
+// leave the high bit clear
+#define HASHMAP_EMPTY ((uint8_t)0x80)
+#define HASHMAP_DELETED ((uint8_t)0xFE)
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Scrambles every bit of value into every other bit, as in the
+ * finalizer of SplitMix64
+ *
+ * @param value value to mix
+ * @return uint64_t mixed value
+ */
+static inline uint64_t hashMap_mix(uint64_t value) {
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9u;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBu;
+  return value ^ (value >> 31);
+}
+
+/**
+ * @brief Finds the largest power of 2 dividing size, capped at the alignment
+ * of any type. Any type's size is a multiple of its alignment, so this is
+ * aligned enough for a type of size bytes.
+ *
+ * @param size bytes of the type
+ * @return size_t alignment of the type
+ */
+static size_t hashMap_alignmentOf(const size_t size) {
+  const size_t maxAlignment = _Alignof(max_align_t);
+  if (size == 0) {
+    return 1;
+  }
+  const size_t alignment = size & -size;
+  return alignment < maxAlignment ? alignment : maxAlignment;
+}
+
+/**
+ * @brief Rounds size up to a multiple of alignment, a power of 2
+ *
+ * @param size bytes to round
+ * @param alignment power of 2 to round to
+ * @return size_t rounded bytes
+ */
+static size_t hashMap_alignUp(const size_t size, const size_t alignment) {
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Number of keys a map of capacity slots holds before rehashing
+ *
+ * @param capacity num. slots
+ * @return size_t 7/8 of capacity
+ */
+static size_t hashMap_maxLoad(const size_t capacity) {
+  return capacity - capacity / 8;
+}
+
+/**
+ * @brief Bitmask of the slots of the group starting at ctrl whose control
+ * bytes equal byte
+ *
+ * @param ctrl first control byte of the group
+ * @param byte control byte to match
+ * @return unsigned bit i set when ctrl[i] == byte
+ */
+static inline unsigned hashMap_matchByte(const uint8_t *const ctrl,
+                                         const uint8_t byte) {
+#if defined(__SSE2__)
+  const __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+  return (unsigned)_mm_movemask_epi8(
+      _mm_cmpeq_epi8(group, _mm_set1_epi8((char)byte)));
+#else
+  unsigned mask = 0;
+  for (unsigned i = 0; i < HASHMAP_GROUP_WIDTH; ++i) {
+    mask |= (unsigned)(ctrl[i] == byte) << i;
+  }
+  return mask;
+#endif
+}
+
+/**
+ * @brief Bitmask of the slots of the group starting at ctrl without a key,
+ * whose control bytes have their high bit set
+ *
+ * @param ctrl first control byte of the group
+ * @return unsigned bit i set when slot i is empty or deleted
+ */
+static inline unsigned hashMap_matchFree(const uint8_t *const ctrl) {
+#if defined(__SSE2__)
+  return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+#else
+  unsigned mask = 0;
+  for (unsigned i = 0; i < HASHMAP_GROUP_WIDTH; ++i) {
+    mask |= (unsigned)(ctrl[i] >> 7) << i;
+  }
+  return mask;
+#endif
+}
+
+/**
+ * @brief Accesses the key in slot of map, which the slot's value follows
+ *
+ * @param map map to access
+ * @param slot index of slot
+ * @return void* pointer to the key
+ */
+static inline void *hashMap_slotKey(const HashMap *const map,
+                                    const size_t slot) {
+  return (char *)map->slots + slot * map->slotSize;
+}
+
+/**
+ * @brief Hashes key with map's hasher, calling the default directly so it can
+ * be inlined
+ *
+ * @param map map key belongs to
+ * @param key key to hash
+ * @return uint64_t hash of key
+ */
+static inline uint64_t hashMap_hash(const HashMap *const map,
+                                    const void *const key) {
+  if (map->hasher == hashMap_hashBytes) {
+    return hashMap_hashBytes(key, map->keySize);
+  }
+  return map->hasher(key, map->keySize);
+}
+
+/**
+ * @brief Compares keys with map's key comparison. The default comparison of
+ * common key sizes is done with a fixed size memcmp, which compiles to a
+ * single compare rather than a call.
+ *
+ * @param map map the keys belong to
+ * @param key1 first key
+ * @param key2 second key
+ * @return true keys are equal
+ * @return false keys differ
+ */
+static inline bool hashMap_keysEqual(const HashMap *const map,
+                                     const void *const key1,
+                                     const void *const key2) {
+  if (map->keyEquals != hashMap_equalsBytes) {
+    return map->keyEquals(key1, key2, map->keySize);
+  }
+  switch (map->keySize) {
+  case sizeof(uint32_t):
+    return memcmp(key1, key2, sizeof(uint32_t)) == 0;
+  case sizeof(uint64_t):
+    return memcmp(key1, key2, sizeof(uint64_t)) == 0;
+  default:
+    return memcmp(key1, key2, map->keySize) == 0;
+  }
+}
+
+/**
+ * @brief Finds the slot holding key. Groups are probed in triangular order,
+ * which visits every group since the number of groups is a power of 2, and
+ * probing stops at the first group with an empty slot.
+ *
+ * @param map map to search
+ * @param key key to find
+ * @param hash hash of key
+ * @return size_t slot holding key, or map->capacity if it's not in map
+ */
+static size_t hashMap_findSlot(const HashMap *const map, const void *const key,
+                               const uint64_t hash) {
+  if (map->capacity == 0) {
+    return map->capacity;
+  }
+  const size_t groupMask = map->capacity / HASHMAP_GROUP_WIDTH - 1;
+  const uint8_t hashBits = (uint8_t)(hash & 0x7F);
+  size_t group = (size_t)(hash >> 7) & groupMask;
+  for (size_t probe = 1;; ++probe) {
+    const uint8_t *const ctrl = map->ctrl + group * HASHMAP_GROUP_WIDTH;
+    for (unsigned match = hashMap_matchByte(ctrl, hashBits); match != 0;
+         match &= match - 1) {
+      const size_t slot =
+          group * HASHMAP_GROUP_WIDTH + (size_t)__builtin_ctz(match);
+      if (hashMap_keysEqual(map, key, hashMap_slotKey(map, slot))) {
+        return slot;
+      }
+    }
+    if (hashMap_matchByte(ctrl, HASHMAP_EMPTY) != 0) {
+      return map->capacity;
+    }
+    group = (group + probe) & groupMask;
+  }
+}
+
+/**
+ * @brief Finds the first empty or deleted slot on hash's probe sequence. map
+ * must have a capacity, which always leaves at least one empty slot.
+ *
+ * @param map map to search
+ * @param hash hash of the key to insert
+ * @return size_t slot to insert into
+ */
+static size_t hashMap_findFreeSlot(const HashMap *const map,
+                                   const uint64_t hash) {
+  const size_t groupMask = map->capacity / HASHMAP_GROUP_WIDTH - 1;
+  size_t group = (size_t)(hash >> 7) & groupMask;
+  for (size_t probe = 1;; ++probe) {
+    const unsigned match =
+        hashMap_matchFree(map->ctrl + group * HASHMAP_GROUP_WIDTH);
+    if (match != 0) {
+      return group * HASHMAP_GROUP_WIDTH + (size_t)__builtin_ctz(match);
+    }
+    group = (group + probe) & groupMask;
+  }
+}
+
+/**
+ * @brief Moves every key of map into a new buffer of capacity slots, which
+ * also clears its deleted slots. Sets errno upon error, leaving map unchanged.
+ *
+ * @param map map to rehash
+ * @param capacity num. slots to rehash into; a power of 2 >= the group width
+ * @return true successfully rehashed
+ * @return false failed to allocate the new buffer
+ */
+static bool hashMap_rehash(HashMap *const map, const size_t capacity) {
+  const char fooName[] = "hashMap_rehash";
+
+  // Allocate control bytes followed by slots in one buffer
+  const size_t ctrlSize = hashMap_alignUp(capacity, _Alignof(max_align_t));
+  uint8_t *const ctrl = malloc(ctrlSize + capacity * map->slotSize);
+  if (ctrl == (uint8_t *)NULL) {
+    fprintf(stderr, "failure allocating memory for hash map contents in %s\n",
+            fooName);
+    return false; // errno set by malloc
+  }
+  JD_COUNT_ALLOCATION(ctrlSize + capacity * map->slotSize);
+  memset(ctrl, HASHMAP_EMPTY, capacity);
+
+  // Move every key into the new buffer
+  HashMap rehashed = *map;
+  rehashed.ctrl = ctrl;
+  rehashed.slots = ctrl + ctrlSize;
+  rehashed.capacity = capacity;
+  rehashed.growthLeft = hashMap_maxLoad(capacity) - map->length;
+  for (size_t slot = hashMap_nextSlot(map, 0); slot < map->capacity;
+       slot = hashMap_nextSlot(map, slot + 1)) {
+    const void *const key = hashMap_slotKey(map, slot);
+    const uint64_t hash = hashMap_hash(map, key);
+    const size_t newSlot = hashMap_findFreeSlot(&rehashed, hash);
+    rehashed.ctrl[newSlot] = (uint8_t)(hash & 0x7F);
+    memcpy(hashMap_slotKey(&rehashed, newSlot), key, map->slotSize);
+  }
+  free(map->ctrl);
+  *map = rehashed;
+  return true;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+HashMap hashMap_constructEmpty(const size_t keySize, const size_t valueSize,
+                               const HashMapHasher hasher,
+                               const HashMapKeyEquals keyEquals) {
+  const size_t keyAlignment = hashMap_alignmentOf(keySize);
+  const size_t valueAlignment = hashMap_alignmentOf(valueSize);
+  const size_t slotAlignment =
+      keyAlignment > valueAlignment ? keyAlignment : valueAlignment;
+  const size_t valueOffset = hashMap_alignUp(keySize, valueAlignment);
+  HashMap map = {
+      .ctrl = (uint8_t *)NULL,
+      .slots = NULL,
+      .capacity = 0,
+      .length = 0,
+      .growthLeft = 0,
+      .keySize = keySize,
+      .valueSize = valueSize,
+      .valueOffset = valueOffset,
+      .slotSize = hashMap_alignUp(valueOffset + valueSize, slotAlignment),
+      .hasher = hasher != (HashMapHasher)NULL ? hasher : hashMap_hashBytes,
+      .keyEquals = keyEquals != (HashMapKeyEquals)NULL ? keyEquals
+                                                       : hashMap_equalsBytes};
+  return map;
+}
+
+OptionalHashMap hashMap_constructCapacity(const size_t capacity,
+                                          const size_t keySize,
+                                          const size_t valueSize,
+                                          const HashMapHasher hasher,
+                                          const HashMapKeyEquals keyEquals) {
+  const char fooName[] = "hashMap_constructCapacity";
+  OptionalHashMap result = {
+      .data = hashMap_constructEmpty(keySize, valueSize, hasher, keyEquals),
+      .valid = false};
+
+  // Argument Validity Checks
+  errno = 0;
+  if (keySize == 0) {
+    fprintf(stderr, "field 'keySize' of %s must be greater than 0\n", fooName);
+    errno = EPERM;
+    return result;
+  }
+
+  // Construction
+  if (!hashMap_reserve(&result.data, capacity)) {
+    fprintf(stderr, "failure reserving hash map capacity in %s\n", fooName);
+    return result; // errno set by hashMap_reserve
+  }
+  result.valid = true;
+  return result;
+}
+
+void hashMap_freeData(const HashMap *const map) {
+  // Return if there's nothing to free
+  if (map == (HashMap *)NULL) {
+    return;
+  }
+  // Free control bytes, which share their buffer with the slots
+  free(map->ctrl);
+}
+
+void *hashMap_find(const HashMap *const map, const void *const key) {
+  const char fooName[] = "hashMap_find";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (map == (HashMap *)NULL) {
+    fprintf(stderr, "field 'map' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return NULL;
+  }
+  if (key == NULL) {
+    fprintf(stderr, "field 'key' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return NULL;
+  }
+
+  // Lookup
+  const uint64_t hash = hashMap_hash(map, key);
+  const size_t slot = hashMap_findSlot(map, key, hash);
+  if (slot == map->capacity) {
+    return NULL;
+  }
+  return hashMap_valueAt(map, slot);
+}
+
+bool hashMap_contains(const HashMap *const map, const void *const key) {
+  const char fooName[] = "hashMap_contains";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (map == (HashMap *)NULL) {
+    fprintf(stderr, "field 'map' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (key == NULL) {
+    fprintf(stderr, "field 'key' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Lookup
+  return hashMap_findSlot(map, key, hashMap_hash(map, key)) !=
+         map->capacity;
+}
+
+bool hashMap_insert(HashMap *const map, const void *const key,
+                    const void *const value) {
+  const char fooName[] = "hashMap_insert";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (map == (HashMap *)NULL) {
+    fprintf(stderr, "field 'map' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (key == NULL) {
+    fprintf(stderr, "field 'key' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (value == NULL && map->valueSize != 0) {
+    fprintf(stderr, "field 'value' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Assign value if key is already in map
+  const uint64_t hash = hashMap_hash(map, key);
+  const size_t existing = hashMap_findSlot(map, key, hash);
+  if (existing != map->capacity) {
+    memcpy(hashMap_valueAt(map, existing), value, map->valueSize);
+    return true;
+  }
+
+  // Rehash when out of empty slots to claim; into the same capacity when
+  // deleted slots are mostly what filled it
+  size_t slot = map->capacity == 0 ? 0 : hashMap_findFreeSlot(map, hash);
+  if (map->capacity == 0 ||
+      (map->growthLeft == 0 && map->ctrl[slot] == HASHMAP_EMPTY)) {
+    size_t capacity = map->capacity;
+    if (capacity == 0) {
+      capacity = HASHMAP_GROUP_WIDTH;
+    } else if (map->length + 1 > hashMap_maxLoad(capacity) / 2) {
+      capacity *= 2;
+    }
+    if (!hashMap_rehash(map, capacity)) {
+      fprintf(stderr, "failure growing hash map in %s\n", fooName);
+      return false; // errno set by hashMap_rehash
+    }
+    slot = hashMap_findFreeSlot(map, hash);
+  }
+
+  // Claim slot
+  if (map->ctrl[slot] == HASHMAP_EMPTY) {
+    --map->growthLeft;
+  }
+  map->ctrl[slot] = (uint8_t)(hash & 0x7F);
+  memcpy(hashMap_slotKey(map, slot), key, map->keySize);
+  if (map->valueSize != 0) {
+    memcpy(hashMap_valueAt(map, slot), value, map->valueSize);
+  }
+  ++map->length;
+  return true;
+}
+
+bool hashMap_erase(HashMap *const map, const void *const key) {
+  const char fooName[] = "hashMap_erase";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (map == (HashMap *)NULL) {
+    fprintf(stderr, "field 'map' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (key == NULL) {
+    fprintf(stderr, "field 'key' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Find key
+  const uint64_t hash = hashMap_hash(map, key);
+  const size_t slot = hashMap_findSlot(map, key, hash);
+  if (slot == map->capacity) {
+    return false;
+  }
+
+  // Erase. A group that still has an empty slot never had a probe pass it, so
+  // the slot can be emptied; otherwise probes must continue past it
+  const uint8_t *const group =
+      map->ctrl + slot / HASHMAP_GROUP_WIDTH * HASHMAP_GROUP_WIDTH;
+  if (hashMap_matchByte(group, HASHMAP_EMPTY) != 0) {
+    map->ctrl[slot] = HASHMAP_EMPTY;
+    ++map->growthLeft;
+  } else {
+    map->ctrl[slot] = HASHMAP_DELETED;
+  }
+  --map->length;
+  return true;
+}
+
+bool hashMap_reserve(HashMap *const map, const size_t numKeys) {
+  const char fooName[] = "hashMap_reserve";
+
+  // Argument Validity Check
+  errno = 0;
+  if (map == (HashMap *)NULL) {
+    fprintf(stderr, "field 'map' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Reservation
+  size_t capacity = HASHMAP_GROUP_WIDTH;
+  while (hashMap_maxLoad(capacity) < numKeys) {
+    capacity *= 2;
+  }
+  if (capacity <= map->capacity) {
+    return true;
+  }
+  if (!hashMap_rehash(map, capacity)) {
+    fprintf(stderr, "failure reserving hash map memory in %s\n", fooName);
+    return false; // errno set by hashMap_rehash
+  }
+  return true;
+}
+
+void hashMap_clear(HashMap *const map) {
+  // Return if there's nothing to clear
+  if (map == (HashMap *)NULL || map->capacity == 0) {
+    return;
+  }
+  memset(map->ctrl, HASHMAP_EMPTY, map->capacity);
+  map->length = 0;
+  map->growthLeft = hashMap_maxLoad(map->capacity);
+}
+
+size_t hashMap_nextSlot(const HashMap *const map, const size_t slot) {
+  for (size_t next = slot; next < map->capacity; ++next) {
+    if ((map->ctrl[next] & HASHMAP_EMPTY) == 0) {
+      return next;
+    }
+  }
+  return map->capacity;
+}
+
+void *hashMap_keyAt(const HashMap *const map, const size_t slot) {
+  return hashMap_slotKey(map, slot);
+}
+
+void *hashMap_valueAt(const HashMap *const map, const size_t slot) {
+  return (char *)hashMap_slotKey(map, slot) + map->valueOffset;
+}
+
+uint64_t hashMap_hashBytes(const void *const key, const size_t keySize) {
+  const unsigned char *const bytes = key;
+  uint64_t hash = 0x9E3779B97F4A7C15u ^ keySize;
+
+  // Multiply each 8 bytes into the state, with fixed size loads of the tail
+  // that may overlap bytes already hashed, so no load depends on keySize
+  if (keySize >= sizeof(uint64_t)) {
+    uint64_t word;
+    size_t offset = 0;
+    for (; offset + sizeof(word) < keySize; offset += sizeof(word)) {
+      memcpy(&word, bytes + offset, sizeof(word));
+      hash = (hash ^ word) * 0xBF58476D1CE4E5B9u;
+    }
+    memcpy(&word, bytes + keySize - sizeof(word), sizeof(word));
+    hash ^= word;
+  } else if (keySize >= sizeof(uint32_t)) {
+    uint32_t low;
+    uint32_t high;
+    memcpy(&low, bytes, sizeof(low));
+    memcpy(&high, bytes + keySize - sizeof(high), sizeof(high));
+    hash ^= (uint64_t)high << 32 | low;
+  } else if (keySize != 0) {
+    hash ^= (uint64_t)bytes[0] << 16 | (uint64_t)bytes[keySize / 2] << 8 |
+            bytes[keySize - 1];
+  }
+  return hashMap_mix(hash);
+}
+
+bool hashMap_equalsBytes(const void *const key1, const void *const key2,
+                         const size_t keySize) {
+  return memcmp(key1, key2, keySize) == 0;
+}
+
+uint64_t hashMap_hashCString(const void *const key, const size_t keySize) {
+  (void)keySize;
+  const char *const chars = *(const char *const *)key;
+  return hashMap_hashBytes(chars, strlen(chars));
+}
+
+bool hashMap_equalsCString(const void *const key1, const void *const key2,
+                           const size_t keySize) {
+  (void)keySize;
+  return strcmp(*(const char *const *)key1, *(const char *const *)key2) == 0;
+}
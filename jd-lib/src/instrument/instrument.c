@@ -0,0 +1,348 @@
+/**
+ * @file instrument.c
+ * @author Justen Di Ruscio
+ * @brief Definitions for per-thread counters and Chrome trace events. Each
+ * thread counts into and buffers events in its own state, so counting never
+ * takes a lock, and tracing only takes the thread's own uncontended one until
+ * its buffer fills.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <jd/instrument.h>
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>  // fprintf
+#include <stdlib.h> // calloc
+#include <time.h>
+#include <unistd.h> // getpid
+
+// events buffered by each thread before being written
+#define JD_TRACE_BUFFER_SIZE 512
+
+/**
+ * @brief Buffered trace event
+ *
+ */
+typedef struct JdTraceEvent {
+  const char *name;
+  char phase;     // 'X' for a complete span or 'C' for a value sample
+  uint64_t tsNs;  // start of the span or time of the sample
+  uint64_t value; // duration of the span or sampled value
+} JdTraceEvent;
+
+/**
+ * @brief Counters and buffered events of one thread, registered in a global
+ * list so readers can merge them
+ *
+ */
+typedef struct JdThreadState {
+  struct JdThreadState *next;
+  struct JdThreadState *prev;
+  unsigned tid; // sequential id shown by trace viewers
+  atomic_uint_least64_t counters[jd_numCounters];
+  pthread_mutex_t eventsMutex; // protects events and numEvents
+  JdTraceEvent events[JD_TRACE_BUFFER_SIZE];
+  size_t numEvents;
+} JdThreadState;
+
+static const char *const counterNames[jd_numCounters] = {
+    [jd_counterTasksEnqueued] = "tasksEnqueued",
+    [jd_counterTasksRun] = "tasksRun",
+    [jd_counterTaskWaitNs] = "taskWaitNs",
+    [jd_counterTaskRunNs] = "taskRunNs",
+    [jd_counterQueueDepthPeak] = "queueDepthPeak",
+    [jd_counterAllocations] = "allocations",
+    [jd_counterAllocatedBytes] = "allocatedBytes",
+    [jd_counterTaskMutexLocks] = "taskMutexLocks",
+    [jd_counterTaskMutexContended] = "taskMutexContended",
+    [jd_counterTaskMutexWaitNs] = "taskMutexWaitNs"};
+
+// Locked in order registryMutex, then a thread's eventsMutex, then fileMutex
+
+// protects threads, exitedCounters and nextTid
+static pthread_mutex_t registryMutex = PTHREAD_MUTEX_INITIALIZER;
+static JdThreadState *threads = (JdThreadState *)NULL;
+static uint64_t exitedCounters[jd_numCounters]; // folded from exited threads
+static unsigned nextTid = 0;
+
+// protects traceFile, traceEmpty and traceOriginNs
+static pthread_mutex_t fileMutex = PTHREAD_MUTEX_INITIALIZER;
+static FILE *traceFile = (FILE *)NULL;
+static bool traceEmpty = true; // no event written yet, so no comma needed
+static uint64_t traceOriginNs = 0;
+static atomic_bool tracing = false;
+
+static pthread_once_t stateKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t stateKey; // runs jd_threadExit when a thread exits
+static _Thread_local JdThreadState *threadState = (JdThreadState *)NULL;
+
+// ==================== PRIVATE FUNCTIONS ===============
+static uint64_t jd_nowNs(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static bool jd_isMaxCounter(const JdCounter counter) {
+  return counter == jd_counterQueueDepthPeak;
+}
+
+/**
+ * @brief Writes state's buffered events to the trace file, if tracing. Must
+ * hold state's eventsMutex.
+ *
+ * @param state state of the thread whose events to write
+ */
+static void jd_writeEvents(JdThreadState *const state) {
+  const int pid = (int)getpid();
+  pthread_mutex_lock(&fileMutex);
+  for (size_t eIdx = 0; traceFile != (FILE *)NULL && eIdx < state->numEvents;
+       ++eIdx) {
+    const JdTraceEvent *const event = &state->events[eIdx];
+    const double tsUs =
+        event->tsNs >= traceOriginNs
+            ? (double)(event->tsNs - traceOriginNs) / 1000.0
+            : 0.0;
+    fprintf(traceFile, "%s{\"name\": \"%s\", \"ph\": \"%c\", \"pid\": %d, "
+                       "\"tid\": %u, \"ts\": %.3f, ",
+            traceEmpty ? "" : ",\n", event->name, event->phase, pid,
+            state->tid, tsUs);
+    if (event->phase == 'X') {
+      fprintf(traceFile, "\"dur\": %.3f}", (double)event->value / 1000.0);
+    } else {
+      fprintf(traceFile, "\"args\": {\"value\": %llu}}",
+              (unsigned long long)event->value);
+    }
+    traceEmpty = false;
+  }
+  pthread_mutex_unlock(&fileMutex);
+  state->numEvents = 0;
+}
+
+/**
+ * @brief Writes an exiting thread's events, folds its counters into
+ * exitedCounters and unregisters it
+ *
+ * @param arg state of the exiting thread
+ */
+static void jd_threadExit(void *const arg) {
+  JdThreadState *const state = arg;
+  pthread_mutex_lock(&registryMutex);
+  pthread_mutex_lock(&state->eventsMutex);
+  jd_writeEvents(state);
+  pthread_mutex_unlock(&state->eventsMutex);
+  for (unsigned cIdx = 0; cIdx < jd_numCounters; ++cIdx) {
+    const uint64_t count = atomic_load_explicit(&state->counters[cIdx],
+                                                memory_order_relaxed);
+    if (!jd_isMaxCounter((JdCounter)cIdx)) {
+      exitedCounters[cIdx] += count;
+    } else if (count > exitedCounters[cIdx]) {
+      exitedCounters[cIdx] = count;
+    }
+  }
+  if (state->prev != (JdThreadState *)NULL) {
+    state->prev->next = state->next;
+  } else {
+    threads = state->next;
+  }
+  if (state->next != (JdThreadState *)NULL) {
+    state->next->prev = state->prev;
+  }
+  pthread_mutex_unlock(&registryMutex);
+  pthread_mutex_destroy(&state->eventsMutex);
+  free(state);
+}
+
+static void jd_createStateKey(void) {
+  pthread_key_create(&stateKey, jd_threadExit);
+}
+
+/**
+ * @brief Gets the calling thread's state, registering it on first use
+ *
+ * @return JdThreadState* state of the calling thread, or NULL if it couldn't
+ * be allocated
+ */
+static JdThreadState *jd_threadState(void) {
+  if (threadState != (JdThreadState *)NULL) {
+    return threadState;
+  }
+
+  // recording mustn't clobber the errno of the code being instrumented
+  const int callerErrno = errno;
+  pthread_once(&stateKeyOnce, jd_createStateKey);
+  JdThreadState *const state = calloc(1, sizeof(JdThreadState));
+  if (state == (JdThreadState *)NULL) {
+    errno = callerErrno;
+    return state;
+  }
+  pthread_mutex_init(&state->eventsMutex, (pthread_mutexattr_t *)NULL);
+  pthread_mutex_lock(&registryMutex);
+  state->tid = ++nextTid;
+  state->next = threads;
+  if (threads != (JdThreadState *)NULL) {
+    threads->prev = state;
+  }
+  threads = state;
+  pthread_mutex_unlock(&registryMutex);
+  pthread_setspecific(stateKey, state);
+  threadState = state;
+  errno = callerErrno;
+  return state;
+}
+
+/**
+ * @brief Buffers an event on the calling thread, writing the buffer out
+ * first when it's full
+ *
+ */
+static void jd_bufferEvent(const char *const name, const char phase,
+                           const uint64_t tsNs, const uint64_t value) {
+  JdThreadState *const state = jd_threadState();
+  if (state == (JdThreadState *)NULL) {
+    return;
+  }
+  const JdTraceEvent event = {
+      .name = name, .phase = phase, .tsNs = tsNs, .value = value};
+  pthread_mutex_lock(&state->eventsMutex);
+  if (state->numEvents == JD_TRACE_BUFFER_SIZE) {
+    const int callerErrno = errno;
+    jd_writeEvents(state);
+    errno = callerErrno;
+  }
+  state->events[state->numEvents++] = event;
+  pthread_mutex_unlock(&state->eventsMutex);
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+void jd_counterAdd(const JdCounter counter, const uint64_t amount) {
+  JdThreadState *const state = jd_threadState();
+  if (state == (JdThreadState *)NULL) {
+    return;
+  }
+  // only this thread writes its counters, so no read-modify-write is needed
+  atomic_uint_least64_t *const count = &state->counters[counter];
+  atomic_store_explicit(
+      count, atomic_load_explicit(count, memory_order_relaxed) + amount,
+      memory_order_relaxed);
+}
+
+void jd_counterMax(const JdCounter counter, const uint64_t value) {
+  JdThreadState *const state = jd_threadState();
+  if (state == (JdThreadState *)NULL) {
+    return;
+  }
+  atomic_uint_least64_t *const count = &state->counters[counter];
+  if (value > atomic_load_explicit(count, memory_order_relaxed)) {
+    atomic_store_explicit(count, value, memory_order_relaxed);
+  }
+}
+
+uint64_t jd_counterRead(const JdCounter counter) {
+  pthread_mutex_lock(&registryMutex);
+  uint64_t merged = exitedCounters[counter];
+  for (JdThreadState *state = threads; state != (JdThreadState *)NULL;
+       state = state->next) {
+    const uint64_t count =
+        atomic_load_explicit(&state->counters[counter], memory_order_relaxed);
+    if (!jd_isMaxCounter(counter)) {
+      merged += count;
+    } else if (count > merged) {
+      merged = count;
+    }
+  }
+  pthread_mutex_unlock(&registryMutex);
+  return merged;
+}
+
+const char *jd_counterName(const JdCounter counter) {
+  return counter < jd_numCounters ? counterNames[counter] : "unknown";
+}
+
+bool jd_traceStart(const char *const path) {
+  const char fooName[] = "jd_traceStart";
+
+  // Argument Validity Check
+  errno = 0;
+  if (path == (char *)NULL) {
+    fprintf(stderr, "argument 'path' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Open trace, dropping events buffered before it started
+  FILE *const file = fopen(path, "w");
+  if (file == (FILE *)NULL) {
+    fprintf(stderr, "Failure opening trace file %s in %s\n", path, fooName);
+    return false; // errno set by fopen
+  }
+  jd_traceStop();
+  pthread_mutex_lock(&registryMutex);
+  for (JdThreadState *state = threads; state != (JdThreadState *)NULL;
+       state = state->next) {
+    pthread_mutex_lock(&state->eventsMutex);
+    state->numEvents = 0;
+    pthread_mutex_unlock(&state->eventsMutex);
+  }
+  pthread_mutex_lock(&fileMutex);
+  traceFile = file;
+  traceEmpty = true;
+  traceOriginNs = jd_nowNs();
+  fprintf(traceFile, "[\n");
+  atomic_store(&tracing, true);
+  pthread_mutex_unlock(&fileMutex);
+  pthread_mutex_unlock(&registryMutex);
+  return true;
+}
+
+void jd_traceStop(void) {
+  atomic_store(&tracing, false);
+  pthread_mutex_lock(&registryMutex);
+  for (JdThreadState *state = threads; state != (JdThreadState *)NULL;
+       state = state->next) {
+    pthread_mutex_lock(&state->eventsMutex);
+    jd_writeEvents(state);
+    pthread_mutex_unlock(&state->eventsMutex);
+  }
+  pthread_mutex_lock(&fileMutex);
+  if (traceFile != (FILE *)NULL) {
+    fprintf(traceFile, "\n]\n");
+    fclose(traceFile);
+    traceFile = (FILE *)NULL;
+  }
+  pthread_mutex_unlock(&fileMutex);
+  pthread_mutex_unlock(&registryMutex);
+}
+
+JdTraceSpan jd_traceBegin(const char *const name) {
+  const JdTraceSpan span = {
+      .name = name,
+      .startNs = atomic_load_explicit(&tracing, memory_order_relaxed)
+                     ? jd_nowNs()
+                     : 0};
+  return span;
+}
+
+void jd_traceEnd(const JdTraceSpan *const span) {
+  if (span->startNs == 0 ||
+      !atomic_load_explicit(&tracing, memory_order_relaxed)) {
+    return;
+  }
+  jd_bufferEvent(span->name, 'X', span->startNs, jd_nowNs() - span->startNs);
+}
+
+void jd_traceValue(const char *const name, const uint64_t value) {
+  if (!atomic_load_explicit(&tracing, memory_order_relaxed)) {
+    return;
+  }
+  jd_bufferEvent(name, 'C', jd_nowNs(), value);
+}
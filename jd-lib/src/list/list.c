@@ -10,6 +10,7 @@
  *
  */
 
+#include <jd/instrument.h>
 #include <jd/list.h>
 
 #include <errno.h>
@@ -524,6 +525,7 @@ ListNode *list_newNode(const size_t dataSize, const void *const element) {
             fooName);
     return (ListNode *)NULL; // errno set by malloc
   }
+  JD_COUNT_ALLOCATION(sizeof(ListNode) + dataSize);
   ListNode *newNode = (ListNode *)listNodeBuffer;
   newNode->data = (char *)listNodeBuffer + sizeof(ListNode);
   newNode->next = (ListNode *)NULL;
@@ -0,0 +1,431 @@
+/**
+ * @file priority_queue.c
+ * @author Justen Di Ruscio
+ * @brief Definitions for a priority queue stored as an array backed d-ary heap
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <jd/instrument.h>
+#include <jd/priority_queue.h>
+
+#include <errno.h>
+#include <stdint.h> // SIZE_MAX
+#include <stdio.h>  // fprintf
+#include <stdlib.h> // realloc
+#include <string.h> // memcpy
+
+// marks positions of free handles, which hold the next free handle instead
+#define PQ_FREE_HANDLE (~(SIZE_MAX >> 1))
+#define PQ_NO_HANDLE (SIZE_MAX >> 1)
+#define PQ_INITIAL_CAPACITY 8
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Accesses the element at heap position of pq
+ *
+ * @param pq priority queue to access
+ * @param position heap position of element
+ * @return void* pointer to the element
+ */
+static inline void *pq_element(const PriorityQueue *const pq,
+                               const size_t position) {
+  return (char *)pq->elements + position * pq->dataSize;
+}
+
+/**
+ * @brief Accesses the extra element after the heap, holding the element being
+ * moved into place while others shift out of its way
+ *
+ * @param pq priority queue to access
+ * @return void* pointer to the scratch element
+ */
+static inline void *pq_scratch(const PriorityQueue *const pq) {
+  return pq_element(pq, pq->capacity);
+}
+
+/**
+ * @brief Moves the element at heap position from to heap position to, along
+ * with its handle
+ *
+ * @param pq priority queue to reorder
+ * @param to heap position to move to
+ * @param from heap position to move from
+ */
+static inline void pq_move(PriorityQueue *const pq, const size_t to,
+                           const size_t from) {
+  memcpy(pq_element(pq, to), pq_element(pq, from), pq->dataSize);
+  pq->handles[to] = pq->handles[from];
+  pq->positions[pq->handles[to]] = to;
+}
+
+/**
+ * @brief Places the element in scratch space, identified by handle, at the
+ * hole at position
+ *
+ * @param pq priority queue to reorder
+ * @param position heap position of the hole
+ * @param handle handle of the element in scratch space
+ */
+static inline void pq_place(PriorityQueue *const pq, const size_t position,
+                            const size_t handle) {
+  memcpy(pq_element(pq, position), pq_scratch(pq), pq->dataSize);
+  pq->handles[position] = handle;
+  pq->positions[handle] = position;
+}
+
+/**
+ * @brief Moves the element in scratch space, identified by handle, from the
+ * hole at position toward the root until its parent comes out before it
+ *
+ * @param pq priority queue to reorder
+ * @param position heap position of the hole
+ * @param handle handle of the element in scratch space
+ */
+static void pq_siftUp(PriorityQueue *const pq, size_t position,
+                      const size_t handle) {
+  const void *const element = pq_scratch(pq);
+  while (position > 0) {
+    const size_t parent = (position - 1) / PQ_ARITY;
+    if (pq->compare(element, pq_element(pq, parent)) >= 0) {
+      break;
+    }
+    pq_move(pq, position, parent);
+    position = parent;
+  }
+  pq_place(pq, position, handle);
+}
+
+/**
+ * @brief Moves the element in scratch space, identified by handle, from the
+ * hole at position toward the leaves until none of its children come out
+ * before it
+ *
+ * @param pq priority queue to reorder
+ * @param position heap position of the hole
+ * @param handle handle of the element in scratch space
+ */
+static void pq_siftDown(PriorityQueue *const pq, size_t position,
+                        const size_t handle) {
+  const void *const element = pq_scratch(pq);
+  for (;;) {
+    const size_t firstChild = position * PQ_ARITY + 1;
+    if (firstChild >= pq->length) {
+      break;
+    }
+    const size_t endChild = firstChild + PQ_ARITY < pq->length
+                                ? firstChild + PQ_ARITY
+                                : pq->length;
+    size_t best = firstChild;
+    for (size_t child = firstChild + 1; child < endChild; ++child) {
+      if (pq->compare(pq_element(pq, child), pq_element(pq, best)) < 0) {
+        best = child;
+      }
+    }
+    if (pq->compare(pq_element(pq, best), element) >= 0) {
+      break;
+    }
+    pq_move(pq, position, best);
+    position = best;
+  }
+  pq_place(pq, position, handle);
+}
+
+/**
+ * @brief Moves the element in scratch space, identified by handle, from the
+ * hole at position to wherever it belongs
+ *
+ * @param pq priority queue to reorder
+ * @param position heap position of the hole
+ * @param handle handle of the element in scratch space
+ */
+static void pq_sift(PriorityQueue *const pq, const size_t position,
+                    const size_t handle) {
+  if (position > 0 &&
+      pq->compare(pq_scratch(pq),
+                  pq_element(pq, (position - 1) / PQ_ARITY)) < 0) {
+    pq_siftUp(pq, position, handle);
+  } else {
+    pq_siftDown(pq, position, handle);
+  }
+}
+
+/**
+ * @brief Checks pq and handle are valid for accessing an element, printing
+ * an error and setting errno if not
+ *
+ * @param pq priority queue to check
+ * @param handle handle to check
+ * @param fooName name of the calling function
+ * @return true handle identifies an element of pq
+ * @return false pq is NULL or handle isn't in pq
+ */
+static bool pq_checkHandle(const PriorityQueue *const pq,
+                           const PriorityQueueHandle handle,
+                           const char *const fooName) {
+  if (pq == (PriorityQueue *)NULL) {
+    fprintf(stderr, "field 'pq' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (!pq_contains(pq, handle)) {
+    fprintf(stderr,
+            "field 'handle' of value %zu in %s doesn't identify an element of "
+            "the provided priority queue\n",
+            handle, fooName);
+    errno = ENOENT;
+    return false;
+  }
+  return true;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+PriorityQueue pq_constructEmpty(const size_t dataSize,
+                                const PriorityQueueCompare compare) {
+  PriorityQueue pq = {.elements = NULL,
+                      .handles = (size_t *)NULL,
+                      .positions = (size_t *)NULL,
+                      .length = 0,
+                      .capacity = 0,
+                      .numHandles = 0,
+                      .freeHandles = PQ_NO_HANDLE,
+                      .dataSize = dataSize,
+                      .compare = compare};
+  return pq;
+}
+
+void pq_freeData(const PriorityQueue *const pq) {
+  // Return if there's nothing to free
+  if (pq == (PriorityQueue *)NULL) {
+    return;
+  }
+  // Free data members
+  free(pq->elements);
+  free(pq->handles);
+  free(pq->positions);
+}
+
+bool pq_reserve(PriorityQueue *const pq, const size_t numElements) {
+  const char fooName[] = "pq_reserve";
+
+  // Argument Validity Check
+  errno = 0;
+  if (pq == (PriorityQueue *)NULL) {
+    fprintf(stderr, "field 'pq' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (numElements <= pq->capacity) {
+    return true;
+  }
+
+  // Reservation; buffers already grown are kept if a later one fails
+  void *const elements =
+      realloc(pq->elements, (numElements + 1) * pq->dataSize);
+  if (elements == NULL) {
+    fprintf(stderr, "failure reallocating priority queue elements in %s\n",
+            fooName);
+    return false; // errno set by realloc
+  }
+  pq->elements = elements;
+  JD_COUNT_ALLOCATION((numElements + 1) * pq->dataSize);
+  size_t *const handles =
+      realloc(pq->handles, numElements * sizeof(*pq->handles));
+  if (handles == (size_t *)NULL) {
+    fprintf(stderr, "failure reallocating priority queue handles in %s\n",
+            fooName);
+    return false; // errno set by realloc
+  }
+  pq->handles = handles;
+  JD_COUNT_ALLOCATION(numElements * sizeof(*pq->handles));
+  size_t *const positions =
+      realloc(pq->positions, numElements * sizeof(*pq->positions));
+  if (positions == (size_t *)NULL) {
+    fprintf(stderr, "failure reallocating priority queue positions in %s\n",
+            fooName);
+    return false; // errno set by realloc
+  }
+  pq->positions = positions;
+  JD_COUNT_ALLOCATION(numElements * sizeof(*pq->positions));
+  pq->capacity = numElements;
+  return true;
+}
+
+bool pq_push(PriorityQueue *const pq, const void *const element,
+             PriorityQueueHandle *const handle) {
+  const char fooName[] = "pq_push";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (pq == (PriorityQueue *)NULL) {
+    fprintf(stderr, "field 'pq' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (element == NULL) {
+    fprintf(stderr, "field 'element' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Grow geometrically when full
+  if (pq->length == pq->capacity) {
+    const size_t capacity =
+        pq->capacity == 0 ? PQ_INITIAL_CAPACITY : 2 * pq->capacity;
+    if (!pq_reserve(pq, capacity)) {
+      fprintf(stderr, "failure growing priority queue in %s\n", fooName);
+      return false; // errno set by pq_reserve
+    }
+  }
+
+  // Reuse a free handle, or give out a new one. There are never more handles
+  // than elements, so they fit in capacity
+  size_t newHandle = pq->freeHandles;
+  if (newHandle != PQ_NO_HANDLE) {
+    pq->freeHandles = pq->positions[newHandle] & ~PQ_FREE_HANDLE;
+  } else {
+    newHandle = pq->numHandles++;
+  }
+
+  // Add element to the end of the heap and sift it up
+  memcpy(pq_scratch(pq), element, pq->dataSize);
+  ++pq->length;
+  pq_siftUp(pq, pq->length - 1, newHandle);
+  if (handle != (PriorityQueueHandle *)NULL) {
+    *handle = newHandle;
+  }
+  return true;
+}
+
+void *pq_top(const PriorityQueue *const pq) {
+  const char fooName[] = "pq_top";
+
+  // Argument Validity Check
+  errno = 0;
+  if (pq == (PriorityQueue *)NULL) {
+    fprintf(stderr, "field 'pq' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return NULL;
+  }
+
+  // Element Access
+  if (pq->length == 0) {
+    errno = EPERM;
+    return NULL;
+  }
+  return pq_element(pq, 0);
+}
+
+bool pq_topHandle(const PriorityQueue *const pq,
+                  PriorityQueueHandle *const handle) {
+  const char fooName[] = "pq_topHandle";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (pq == (PriorityQueue *)NULL) {
+    fprintf(stderr, "field 'pq' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+  if (handle == (PriorityQueueHandle *)NULL) {
+    fprintf(stderr, "field 'handle' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Handle Access
+  if (pq->length == 0) {
+    errno = EPERM;
+    return false;
+  }
+  *handle = pq->handles[0];
+  return true;
+}
+
+bool pq_pop(PriorityQueue *const pq, void *const element) {
+  PriorityQueueHandle top;
+  if (!pq_topHandle(pq, &top)) {
+    return false; // errno set by pq_topHandle
+  }
+  return pq_erase(pq, top, element);
+}
+
+void *pq_at(const PriorityQueue *const pq, const PriorityQueueHandle handle) {
+  const char fooName[] = "pq_at";
+
+  // Argument Validity Check
+  errno = 0;
+  if (!pq_checkHandle(pq, handle, fooName)) {
+    return NULL; // errno set by pq_checkHandle
+  }
+
+  // Element Access
+  return pq_element(pq, pq->positions[handle]);
+}
+
+bool pq_contains(const PriorityQueue *const pq,
+                 const PriorityQueueHandle handle) {
+  return pq != (PriorityQueue *)NULL && handle < pq->numHandles &&
+         (pq->positions[handle] & PQ_FREE_HANDLE) == 0;
+}
+
+bool pq_update(PriorityQueue *const pq, const PriorityQueueHandle handle,
+               const void *const element) {
+  const char fooName[] = "pq_update";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (!pq_checkHandle(pq, handle, fooName)) {
+    return false; // errno set by pq_checkHandle
+  }
+  if (element == NULL) {
+    fprintf(stderr, "field 'element' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Reassign element and move it up or down from where it was
+  memcpy(pq_scratch(pq), element, pq->dataSize);
+  pq_sift(pq, pq->positions[handle], handle);
+  return true;
+}
+
+bool pq_erase(PriorityQueue *const pq, const PriorityQueueHandle handle,
+              void *const element) {
+  const char fooName[] = "pq_erase";
+
+  // Argument Validity Check
+  errno = 0;
+  if (!pq_checkHandle(pq, handle, fooName)) {
+    return false; // errno set by pq_checkHandle
+  }
+
+  // Remove element and free its handle
+  const size_t position = pq->positions[handle];
+  if (element != NULL) {
+    memcpy(element, pq_element(pq, position), pq->dataSize);
+  }
+  pq->positions[handle] = PQ_FREE_HANDLE | pq->freeHandles;
+  pq->freeHandles = handle;
+  --pq->length;
+
+  // Fill the hole with the last element of the heap
+  if (position != pq->length) {
+    memcpy(pq_scratch(pq), pq_element(pq, pq->length), pq->dataSize);
+    pq_sift(pq, position, pq->handles[pq->length]);
+  }
+  return true;
+}
+
+size_t pq_length(const PriorityQueue *const pq) { return pq->length; }
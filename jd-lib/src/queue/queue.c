@@ -12,6 +12,9 @@
 #include "jd/list.h"
 #include <jd/queue.h>
 
+#include <stdlib.h> // free
+#include <string.h> // memcpy
+
 Queue q_constructEmpty(const size_t dataSize) {
   Queue q;
   q.elements = list_constructEmpty(dataSize);
@@ -26,6 +29,32 @@ bool q_enqueue(Queue *const q, const void *const element) {
 
 bool q_dequeue(Queue *const q) { return list_popFront(&q->elements); }
 
+JdStatus q_tryPop(Queue *const q, void *const element) {
+  List *const list = &q->elements;
+  ListNode *const head = list->head;
+  if (head == (ListNode *)NULL) {
+    return jd_status(ENOENT);
+  }
+
+  // Unlink front node
+  list->head = head->next;
+  if (list->head == (ListNode *)NULL) {
+    list->tail = (ListNode *)NULL;
+  } else {
+    list->head->prev = (ListNode *)NULL;
+  }
+  --list->length;
+
+  // Move element out, or drop it
+  if (element != (void *)NULL) {
+    memcpy(element, head->data, list->dataSize);
+    free(head);
+  } else {
+    list_freeNode(list, head);
+  }
+  return jd_status(0);
+}
+
 void *q_front(const Queue *const q) { return list_elementAt(&q->elements, 0); }
 
 void *q_back(const Queue *const q) {
@@ -0,0 +1,575 @@
+/**
+ * @file string.c
+ * @author Justen Di Ruscio (3624673)
+ * @brief Definitions for arbitrary length, null terminated strings and their
+ * manipulation. Strings shorter than STRING_SMALL_CAPACITY are stored inline
+ * in the String rather than on the heap.
+ * @version 0.1
+ * @date 2021-02-16
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <jd/string.h>
+
+#include <jd/arena.h>
+#include <jd/instrument.h>
+
+#include <stdint.h>
+#include <stdio.h>  // fprintf
+#include <stdlib.h> // malloc
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// most delimeters stringView_tokenize compares 16 chars at a time against;
+// larger sets are looked up one char at a time
+#define STRING_SIMD_DELIMETERS 8
+#define STRING_SIMD_WIDTH 16
+
+/**
+ * @brief Set of delimeters prepared for scanning by stringView_tokenize
+ *
+ */
+typedef struct StringDelimeters {
+  uint64_t table[4]; // bit per char value, set for delimeters
+#if defined(__SSE2__)
+  __m128i broadcast[STRING_SIMD_DELIMETERS]; // each delimeter in every lane
+  size_t numBroadcast; // 0 when there are too many delimeters for SIMD
+#endif
+} StringDelimeters;
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Indicates whether str's chars are stored inline
+ *
+ * @param str String
+ * @return true chars are in str->buffer.small
+ * @return false chars are in str->buffer.heap
+ */
+static bool string_isSmall(const String *const str) {
+  return str->capacity <= STRING_SMALL_CAPACITY;
+}
+
+/**
+ * @brief Constructs a String holding a copy of length chars, with room for at
+ * least capacity chars. Sets errno upon error.
+ *
+ * @param chars chars to copy; need not be null terminated
+ * @param length number of chars to copy
+ * @param capacity requested capacity; raised to fit chars and null termination
+ * @param arena arena to allocate from, or NULL to allocate on the heap
+ * @return OptionalString constructed string and flag to indicate validity of
+ * the String
+ */
+static OptionalString string_constructChars(const char *const chars,
+                                            const size_t length,
+                                            const size_t capacity,
+                                            struct Arena *const arena) {
+  const char fooName[] = "string_constructChars";
+  OptionalString result = string_constructCapacityArena(
+      capacity > length ? capacity : length + 1, arena);
+  if (!result.valid) {
+    fprintf(stderr, "Unable to allocate memory for string in %s\n", fooName);
+    return result; // errno set by string_constructCapacity
+  }
+  char *const data = string_data(&result.data);
+  memcpy(data, chars, length);
+  data[length] = '\0';
+  result.data.length = length;
+  return result;
+}
+
+/**
+ * @brief Prepares delimeters for scanning
+ *
+ * @param delims out-parameter set of delimeters
+ * @param delimeters chars to scan for
+ */
+static void string_initDelimeters(StringDelimeters *const delims,
+                                  const StringView delimeters) {
+  memset(delims->table, 0, sizeof(delims->table));
+  for (size_t dIdx = 0; dIdx < delimeters.length; ++dIdx) {
+    const unsigned char delim = (unsigned char)delimeters.data[dIdx];
+    delims->table[delim >> 6] |= (uint64_t)1 << (delim & 63);
+  }
+#if defined(__SSE2__)
+  delims->numBroadcast = 0;
+  if (delimeters.length <= STRING_SIMD_DELIMETERS) {
+    for (size_t dIdx = 0; dIdx < delimeters.length; ++dIdx) {
+      delims->broadcast[dIdx] = _mm_set1_epi8(delimeters.data[dIdx]);
+    }
+    delims->numBroadcast = delimeters.length;
+  }
+#endif
+}
+
+/**
+ * @brief Indicates whether c is one of delims
+ *
+ * @param delims set of delimeters
+ * @param c char to look up
+ * @return true c is a delimeter
+ * @return false c isn't a delimeter
+ */
+static inline bool string_isDelimeter(const StringDelimeters *const delims,
+                                      const char c) {
+  const unsigned char uc = (unsigned char)c;
+  return (delims->table[uc >> 6] >> (uc & 63)) & 1;
+}
+
+/**
+ * @brief Finds the first char of data, from pos onward, that is a delimeter
+ * when findDelimeter is true or isn't one when it's false
+ *
+ * @param data chars to scan
+ * @param length number of chars in data
+ * @param pos index to start scanning at
+ * @param delims set of delimeters
+ * @param findDelimeter whether to stop at a delimeter or at a non-delimeter
+ * @return size_t index of the found char, or length if there's none
+ */
+static size_t string_scan(const char *const data, const size_t length,
+                          size_t pos, const StringDelimeters *const delims,
+                          const bool findDelimeter) {
+#if defined(__SSE2__)
+  // compare a chunk against every delimeter, then find the first match
+  if (delims->numBroadcast != 0) {
+    while (pos + STRING_SIMD_WIDTH <= length) {
+      const __m128i chunk = _mm_loadu_si128((const __m128i *)(data + pos));
+      __m128i matches = _mm_cmpeq_epi8(chunk, delims->broadcast[0]);
+      for (size_t dIdx = 1; dIdx < delims->numBroadcast; ++dIdx) {
+        matches = _mm_or_si128(matches,
+                               _mm_cmpeq_epi8(chunk, delims->broadcast[dIdx]));
+      }
+      unsigned mask = (unsigned)_mm_movemask_epi8(matches);
+      if (!findDelimeter) {
+        mask = ~mask & 0xFFFFu;
+      }
+      if (mask != 0) {
+        return pos + (size_t)__builtin_ctz(mask);
+      }
+      pos += STRING_SIMD_WIDTH;
+    }
+  }
+#endif
+  while (pos < length &&
+         string_isDelimeter(delims, data[pos]) != findDelimeter) {
+    ++pos;
+  }
+  return pos;
+}
+
+/**
+ * @brief Finds the next token of view, starting at pos
+ *
+ * @param view chars to tokenize
+ * @param delims set of delimeters separating tokens
+ * @param pos in-out index to resume from; set past the found token
+ * @param span out-parameter position of the found token
+ * @return true a token was found
+ * @return false no tokens remain
+ */
+static bool string_nextSpan(const StringView view,
+                            const StringDelimeters *const delims,
+                            size_t *const pos, StringSpan *const span) {
+  const size_t start = string_scan(view.data, view.length, *pos, delims, false);
+  if (start == view.length) {
+    *pos = start;
+    return false;
+  }
+  const size_t end = string_scan(view.data, view.length, start, delims, true);
+  span->offset = start;
+  span->length = end - start;
+  *pos = end;
+  return true;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+String string_constructEmpty() {
+  String result = {.buffer = {.small = {'\0'}},
+                   .length = 0,
+                   .capacity = STRING_SMALL_CAPACITY,
+                   .arena = (struct Arena *)NULL};
+  return result;
+}
+
+OptionalString string_constructCapacity(const size_t capacity) {
+  return string_constructCapacityArena(capacity, (struct Arena *)NULL);
+}
+
+OptionalString string_constructCapacityArena(const size_t capacity,
+                                             struct Arena *const arena) {
+  const char fooName[] = "string_constructCapacityArena";
+  String string = string_constructEmpty();
+  string.arena = arena;
+  OptionalString result = {.data = string, .valid = false};
+  errno = 0;
+
+  // Small strings fit inline
+  if (capacity <= STRING_SMALL_CAPACITY) {
+    result.valid = true;
+    return result;
+  }
+
+  void *const newStringBuff = arena != (struct Arena *)NULL
+                                  ? arena_alloc(arena, capacity)
+                                  : malloc(capacity);
+  if (newStringBuff == (void *)NULL) {
+    fprintf(stderr, "Error allocating memory for string in %s\n", fooName);
+    return result; // errno set by malloc or arena_alloc
+  }
+  if (arena == (struct Arena *)NULL) {
+    JD_COUNT_ALLOCATION(capacity);
+  }
+
+  string.capacity = capacity;
+  string.buffer.heap = (char *)newStringBuff;
+  string.buffer.heap[0] = '\0';
+  result.data = string;
+  result.valid = true;
+  return result;
+}
+
+OptionalString string_copyConstruct(const String *const other) {
+  const char fooName[] = "string_copyConstruct";
+  String string = string_constructEmpty();
+  OptionalString result = {.data = string, .valid = false};
+
+  // Argument Validity Check
+  errno = 0;
+  if (other == (String *)NULL) {
+    fprintf(stderr,
+            "field 'other' of %s must point to a "
+            "valid address\n",
+            fooName);
+    errno = EPERM;
+    return result;
+  }
+
+  // Copy Construct
+  return string_constructChars(string_constData(other), other->length,
+                               other->capacity, (struct Arena *)NULL);
+}
+
+OptionalString string_copyConstructChar(const char *const other) {
+  const char fooName[] = "string_copyConstructChar";
+  String string = string_constructEmpty();
+  OptionalString result = {.data = string, .valid = false};
+
+  // Argument Validity Check
+  errno = 0;
+  if (other == (char *)NULL) {
+    fprintf(stderr,
+            "field 'other' of %s must point to a "
+            "valid address\n",
+            fooName);
+    errno = EPERM;
+    return result;
+  }
+
+  // Copy Construct
+  const size_t length = strlen(other);
+  return string_constructChars(other, length, length * 1.5 + 1,
+                               (struct Arena *)NULL);
+}
+
+OptionalString string_constructView(const StringView view) {
+  return string_constructViewArena(view, (struct Arena *)NULL);
+}
+
+OptionalString string_constructViewArena(const StringView view,
+                                         struct Arena *const arena) {
+  const char fooName[] = "string_constructViewArena";
+  String string = string_constructEmpty();
+  OptionalString result = {.data = string, .valid = false};
+
+  // Argument Validity Check
+  errno = 0;
+  if (view.data == (char *)NULL && view.length != 0) {
+    fprintf(stderr,
+            "field 'data' of argument 'view' of %s must point to a "
+            "valid address\n",
+            fooName);
+    errno = EPERM;
+    return result;
+  }
+
+  // Copy Construct
+  return string_constructChars(view.data, view.length, view.length + 1, arena);
+}
+
+char *string_data(String *const str) {
+  return string_isSmall(str) ? str->buffer.small : str->buffer.heap;
+}
+
+const char *string_constData(const String *const str) {
+  return string_isSmall(str) ? str->buffer.small : str->buffer.heap;
+}
+
+void string_freeData(const String *const str) {
+  // Return if there's nothing to free
+  if (str == (String *)NULL) {
+    return;
+  }
+  // Free data member, which small strings and arena strings don't own
+  if (!string_isSmall(str) && str->arena == (struct Arena *)NULL) {
+    free(str->buffer.heap);
+  }
+}
+
+void string_freeDataVoid(const void *const str) {
+  // Return if there's nothing to free
+  if (str == (void *)NULL) {
+    return;
+  }
+  // Free data member
+  const String *const string = (String *)str;
+  string_freeData(string);
+}
+
+bool string_reserve(String *const str, const size_t newCapacity) {
+  const char fooName[] = "string_reserve";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (str == (String *)NULL) {
+    fprintf(stderr,
+            "field 'str' of %s must point to a "
+            "valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Reserve, moving small strings' chars out of the String onto the heap
+  if (newCapacity > str->capacity) {
+    if (string_isSmall(str)) {
+      char *const newBuffer = str->arena != (struct Arena *)NULL
+                                  ? arena_alloc(str->arena, newCapacity)
+                                  : malloc(newCapacity);
+      if (newBuffer == (char *)NULL) {
+        fprintf(stderr, "Error reserving string buffer with malloc in %s\n",
+                fooName);
+        return false; // malloc or arena_alloc sets errno
+      }
+      if (str->arena == (struct Arena *)NULL) {
+        JD_COUNT_ALLOCATION(newCapacity);
+      }
+      memcpy(newBuffer, str->buffer.small, STRING_SMALL_CAPACITY);
+      str->buffer.heap = newBuffer;
+    } else if (str->arena != (struct Arena *)NULL) {
+      char *const newBuffer = arena_grow(str->arena, str->buffer.heap,
+                                         str->capacity, newCapacity);
+      if (newBuffer == (char *)NULL) {
+        fprintf(stderr, "Error reserving string buffer in arena in %s\n",
+                fooName);
+        return false; // arena_grow sets errno
+      }
+      str->buffer.heap = newBuffer;
+    } else {
+      const void *const newBuffer = realloc(str->buffer.heap, newCapacity);
+      if (newBuffer == (void *)NULL) {
+        fprintf(stderr, "Error reserving string buffer with realloc in %s\n",
+                fooName);
+        return false; // realloc sets errno
+      }
+      JD_COUNT_ALLOCATION(newCapacity);
+      str->buffer.heap = (char *)newBuffer;
+    }
+    str->capacity = newCapacity;
+  }
+  return true;
+}
+
+OptionalVector string_split(const String *const str, const char *const delim) {
+  const char fooName[] = "string_split";
+  OptionalVector result = {.data = {.data = NULL}, .valid = false};
+
+  // Argument Validity Check
+  errno = 0;
+  if (str == (String *)NULL) {
+    fprintf(stderr,
+            "field 'str' of %s must point to a "
+            "valid address\n",
+            fooName);
+    errno = EPERM;
+    return result;
+  }
+  if (delim == (char *)NULL) {
+    fprintf(stderr,
+            "field 'delim' of %s must point to a "
+            "valid address\n",
+            fooName);
+    errno = EPERM;
+    return result;
+  }
+
+  // Split String into Parts
+  return stringView_split(string_view(str), stringView_fromChar(delim));
+}
+
+int string_compare(const String *const first, const String *const second) {
+  return strcmp(string_constData(first), string_constData(second));
+}
+
+int string_compareChar(const String *const first, const char *const second) {
+  return strcmp(string_constData(first), second);
+}
+
+bool string_contains(const String *const string, const char element) {
+  const char fooName[] = "string_contains";
+  errno = 0;
+
+  // Argument Validity Check
+  if (string == (String *)NULL) {
+    fprintf(stderr, "argument 'string' of %s must point to a valid string\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Contains
+  return stringView_contains(string_view(string), element);
+}
+
+OptionalString string_strip(const String *const string,
+                            const String *const delimeters) {
+  const char fooName[] = "string_strip";
+  OptionalString result = {.data = string_constructEmpty(), .valid = false};
+
+  // Argument Validity Checks
+  errno = 0;
+  if (string == (String *)NULL) {
+    fprintf(stderr, "argument 'string' of %s must point to a valid string\n",
+            fooName);
+    errno = EPERM;
+    return result;
+  }
+  if (delimeters == (String *)NULL) {
+    fprintf(stderr,
+            "argument 'delimeters' of %s must point to a valid string\n",
+            fooName);
+    errno = EPERM;
+    return result;
+  }
+
+  // Strip, copying the stripped chars into a new string
+  const StringView stripped =
+      stringView_strip(string_view(string), string_view(delimeters));
+  return string_constructView(stripped);
+}
+
+StringView string_view(const String *const str) {
+  StringView view = {.data = string_constData(str), .length = str->length};
+  return view;
+}
+
+StringView stringView_fromChar(const char *const chars) {
+  StringView view = {.data = chars, .length = strlen(chars)};
+  return view;
+}
+
+bool stringView_contains(const StringView view, const char element) {
+  return view.length != 0 && memchr(view.data, element, view.length) != NULL;
+}
+
+StringView stringView_strip(const StringView view,
+                            const StringView delimeters) {
+  StringView stripped = view;
+  while (stripped.length != 0 &&
+         stringView_contains(delimeters, stripped.data[0])) {
+    ++stripped.data;
+    --stripped.length;
+  }
+  while (stripped.length != 0 &&
+         stringView_contains(delimeters,
+                             stripped.data[stripped.length - 1])) {
+    --stripped.length;
+  }
+  return stripped;
+}
+
+size_t stringView_tokenize(const StringView view, const StringView delimeters,
+                           StringSpan *const spans, const size_t maxSpans) {
+  StringDelimeters delims;
+  string_initDelimeters(&delims, delimeters);
+
+  size_t numSpans = 0;
+  size_t pos = 0;
+  StringSpan span;
+  while (string_nextSpan(view, &delims, &pos, &span)) {
+    if (numSpans < maxSpans) {
+      spans[numSpans] = span;
+    }
+    ++numSpans;
+  }
+  return numSpans;
+}
+
+StringView stringView_span(const StringView view, const StringSpan span) {
+  StringView spanView = {.data = view.data + span.offset,
+                         .length = span.length};
+  return spanView;
+}
+
+OptionalVector stringView_split(const StringView view,
+                                const StringView delimeters) {
+  return stringView_splitArena(view, delimeters, (struct Arena *)NULL);
+}
+
+OptionalVector stringView_splitArena(const StringView view,
+                                     const StringView delimeters,
+                                     struct Arena *const arena) {
+  const char fooName[] = "stringView_splitArena";
+  OptionalVector result = {.data = {.data = NULL}, .valid = false};
+
+  // create vector to store split string pieces
+  const unsigned initialCapacity = 8;
+  OptionalVector v =
+      vector_constructCapacityArena(initialCapacity, sizeof(String), arena);
+  if (!v.valid) {
+    fprintf(stderr,
+            "Unable to construct vector for string pieces with default "
+            "capacity of %u in %s\n",
+            initialCapacity, fooName);
+    return result; // errno set by vector_constructCapacity
+  }
+  Vector splitStrings = v.data;
+  splitStrings.elementDeleter = string_freeDataVoid;
+
+  // tokenize view into pieces without modifying it, pushing into vector
+  StringDelimeters delims;
+  string_initDelimeters(&delims, delimeters);
+  size_t pos = 0;
+  StringSpan span;
+  while (string_nextSpan(view, &delims, &pos, &span)) {
+    OptionalString stringPiece =
+        string_constructViewArena(stringView_span(view, span), arena);
+    if (!stringPiece.valid) {
+      fprintf(stderr, "Unable to construct string from token in %s\n", fooName);
+      vector_freeElements(&splitStrings);
+      vector_freeData(&splitStrings);
+      return result; // errno set by string_constructView
+    }
+    const bool pushed = vector_pushBack(&splitStrings, &stringPiece.data);
+    if (!pushed) {
+      fprintf(stderr,
+              "Error pushing string token %s into vector of tokens in %s\n",
+              string_constData(&stringPiece.data), fooName);
+      string_freeData(&stringPiece.data);
+      vector_freeElements(&splitStrings);
+      vector_freeData(&splitStrings);
+      return result; // errno set by vector_pushBack
+    }
+  }
+
+  // return container holding split strings
+  result.valid = true;
+  result.data = splitStrings;
+  return result;
+}
@@ -0,0 +1,510 @@
+/**
+ * @file task.c
+ * @author Justen Di Ruscio
+ * @brief Definitions for Task abstraction
+ * @version 0.1
+ * @date 2021-03-20
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+#define _GNU_SOURCE
+
+#include <jd/threadpool.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// continuations of a completed task; pushing onto it runs the continuation
+#define TASK_CONTINUATIONS_CLOSED ((TaskContinuation *)(uintptr_t)1)
+
+// shared bookkeeping of task_whenAll and task_whenAny, freed by its last hook
+typedef struct TaskJoin {
+  atomic_size_t remaining; // antecedents left to complete before firing
+  atomic_size_t refs;      // hooks not yet run
+  Task *continuation;
+  struct ThreadPool *tp;
+} TaskJoin;
+
+// continuation registered on each antecedent of a TaskJoin
+typedef struct TaskJoinHook {
+  TaskContinuation node; // must be first
+  TaskJoin *join;
+} TaskJoinHook;
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Sleeps until state no longer holds expected or the thread is woken
+ *
+ * @param state futex word
+ * @param expected value to sleep on
+ * @return int 0, or errno upon error other than a spurious or early wake
+ */
+static int task_futexWait(atomic_uint *const state, const unsigned expected) {
+  const long err = syscall(SYS_futex, state, FUTEX_WAIT_PRIVATE, expected,
+                           NULL, NULL, 0);
+  if (err == -1 && errno != EAGAIN && errno != EINTR) {
+    return errno;
+  }
+  return 0;
+}
+
+/**
+ * @brief Wakes every thread sleeping on state
+ *
+ * @param state futex word
+ */
+static void task_futexWakeAll(atomic_uint *const state) {
+  syscall(SYS_futex, state, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+/**
+ * @brief Enqueues continuation into tp, or runs it on the calling thread when
+ * tp is NULL. When it can't be enqueued or run, it's completed without
+ * running, with the error as its fooErrno, so its waiters still wake. Sets
+ * errno upon error.
+ *
+ * @param continuation task to run
+ * @param tp thread pool or NULL
+ * @return int errno
+ */
+static int task_schedule(Task *const continuation,
+                         struct ThreadPool *const tp) {
+  const char fooName[] = "task_schedule";
+
+  if (tp != (struct ThreadPool *)NULL) {
+    errno = tp_enqueueImmediate(tp, continuation);
+    if (errno == 0) {
+      return errno;
+    }
+    fprintf(stderr, "Failure enqueueing continuation in %s\n", fooName);
+  } else {
+    errno = task_execute(continuation);
+    if (errno != 0) {
+      fprintf(stderr, "Failure executing continuation in %s\n", fooName);
+    }
+  }
+
+  const int scheduleErr = errno;
+  if (scheduleErr != 0) {
+    continuation->fooErrno = scheduleErr;
+  }
+  errno = task_markCompleted(continuation);
+  if (scheduleErr != 0) {
+    errno = scheduleErr;
+  }
+  return errno;
+}
+
+/**
+ * @brief run function of Task::thenNode, scheduling the task it's part of
+ *
+ * @param node thenNode of a continuation
+ */
+static void task_runThen(TaskContinuation *const node) {
+  Task *const continuation =
+      (Task *)((char *)node - offsetof(Task, thenNode));
+  task_schedule(continuation, continuation->thenPool);
+}
+
+/**
+ * @brief run function of a TaskJoinHook: fires the join's continuation once
+ * enough antecedents arrived and frees the join after its last hook
+ *
+ * @param node node of a TaskJoinHook
+ */
+static void task_joinArrive(TaskContinuation *const node) {
+  TaskJoin *const join = ((TaskJoinHook *)node)->join;
+  if (atomic_fetch_sub(&join->remaining, 1) == 1) {
+    task_schedule(join->continuation, join->tp);
+  }
+  if (atomic_fetch_sub(&join->refs, 1) == 1) {
+    free(join);
+  }
+}
+
+/**
+ * @brief Adds node to task's continuations, or runs it immediately when task
+ * already completed
+ *
+ * @param task antecedent
+ * @param node continuation to run after task
+ */
+static void task_pushContinuation(Task *const task,
+                                  TaskContinuation *const node) {
+  TaskContinuation *head =
+      atomic_load_explicit(&task->continuations, memory_order_acquire);
+  do {
+    if (head == TASK_CONTINUATIONS_CLOSED) {
+      node->run(node);
+      return;
+    }
+    node->next = head;
+  } while (!atomic_compare_exchange_weak_explicit(
+      &task->continuations, &head, node, memory_order_release,
+      memory_order_acquire));
+}
+
+/**
+ * @brief Allocates a join firing continuation after numArrivals of numTasks
+ * arrive, and hooks it onto every one of tasks. Sets errno upon error.
+ *
+ * @param tasks antecedents
+ * @param numTasks number of antecedents
+ * @param numArrivals antecedents to complete before firing
+ * @param continuation task to run once fired
+ * @param tp thread pool to run continuation in, or NULL
+ * @return int errno
+ */
+static int task_join(Task *const *const tasks, const size_t numTasks,
+                     const size_t numArrivals, Task *const continuation,
+                     struct ThreadPool *const tp) {
+  const char fooName[] = "task_join";
+
+  // hooks are allocated with the join, which they free when done
+  TaskJoin *const join =
+      malloc(sizeof(TaskJoin) + numTasks * sizeof(TaskJoinHook));
+  if (join == (TaskJoin *)NULL) {
+    fprintf(stderr, "Failure allocating join of %zu tasks in %s\n", numTasks,
+            fooName);
+    return errno; // errno set by malloc
+  }
+  TaskJoinHook *const hooks = (TaskJoinHook *)(join + 1);
+  atomic_init(&join->remaining, numArrivals);
+  atomic_init(&join->refs, numTasks);
+  join->continuation = continuation;
+  join->tp = tp;
+
+  for (size_t tIdx = 0; tIdx < numTasks; ++tIdx) {
+    hooks[tIdx].node.run = task_joinArrive;
+    hooks[tIdx].join = join;
+  }
+  // join may be freed by the last push, so hooks are initialized beforehand
+  for (size_t tIdx = 0; tIdx < numTasks; ++tIdx) {
+    task_pushContinuation(tasks[tIdx], &hooks[tIdx].node);
+  }
+  return errno;
+}
+
+/**
+ * @brief Validates the arguments shared by task_whenAll and task_whenAny.
+ * Sets errno upon error.
+ *
+ * @param fooName name of calling function
+ * @param tasks tasks to wait on
+ * @param numTasks number of tasks
+ * @param continuation task to run
+ * @return int errno
+ */
+static int task_checkJoinArgs(const char *const fooName,
+                              Task *const *const tasks, const size_t numTasks,
+                              Task *const continuation) {
+  errno = 0;
+  if (tasks == (Task *const *)NULL && numTasks != 0) {
+    fprintf(stderr, "argument 'tasks' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (continuation == (Task *)NULL) {
+    fprintf(stderr,
+            "argument 'continuation' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  for (size_t tIdx = 0; tIdx < numTasks; ++tIdx) {
+    if (tasks[tIdx] == (Task *)NULL) {
+      fprintf(stderr, "element %zu of argument 'tasks' of %s must point to a "
+                      "valid address\n",
+              tIdx, fooName);
+      errno = EPERM;
+      return errno;
+    }
+  }
+  return errno;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+
+int task_init(Task *const task, void *(*foo)(void *), void *fooArg,
+              void **fooReturn) {
+  const char fooName[] = "tp_initTask";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (foo == NULL) {
+    fprintf(stderr, "argument 'foo' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  // Init Provided Task
+  task->foo = foo;
+  task->fooArg = fooArg;
+  task->fooReturn = fooReturn;
+  task->fooErrno = 0;
+  atomic_init(&task->state, task_Pending);
+  atomic_init(&task->continuations, (TaskContinuation *)NULL);
+  task->thenNode.next = (TaskContinuation *)NULL;
+  task->thenNode.run = task_runThen;
+  task->thenPool = (struct ThreadPool *)NULL;
+  task->enqueuedNs = 0;
+  task->periodMs = 0;
+  atomic_init(&task->cancelled, false);
+  task->timerExpiry = 0;
+  task->next = (Task *)NULL;
+  atomic_init(&task->ownership, 0);
+
+  return errno;
+}
+
+int task_destroy(Task *const task) {
+  const char fooName[] = "tp_destoryTask";
+
+  // Argument Validity Check
+  errno = 0;
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  // Destory provided Task
+  task->foo = NULL;
+  task->fooArg = (void *)NULL;
+  task->fooReturn = (void *)NULL;
+  task->fooErrno = 0;
+
+  // unblock any blocked callers, then let the pool finish with task
+  errno = task_markCompleted(task);
+  task_awaitPool(task);
+  return errno;
+}
+
+int task_execute(Task *const task) {
+  const char fooName[] = "task_execute";
+
+  // Argument Validity Check
+  errno = 0;
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  // Execute function and store result;
+  void *result = task->foo(task->fooArg);
+  if (task->fooReturn != NULL) {
+    *(task->fooReturn) = result;
+  }
+  task->fooErrno = errno;
+  return 0;
+}
+
+int task_markCompleted(Task *const task) {
+  const char fooName[] = "task_markCompleted";
+
+  // Argument Validity Check
+  errno = 0;
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  // Close continuations before publishing completion, since waiters may
+  // destroy task as soon as they see it completed
+  TaskContinuation *continuations = atomic_exchange_explicit(
+      &task->continuations, TASK_CONTINUATIONS_CLOSED, memory_order_acq_rel);
+  if (continuations == TASK_CONTINUATIONS_CLOSED) {
+    return errno; // already completed
+  }
+
+  // Wake sleepers only if some announced themselves. A waiter that sees the
+  // exchange may destroy task before the wake, which is harmless since any
+  // other futex woken at the address rechecks its own state
+  const unsigned previous = atomic_exchange_explicit(
+      &task->state, task_Completed, memory_order_acq_rel);
+  if (previous == task_Waiting) {
+    task_futexWakeAll(&task->state);
+  }
+
+  // Run continuations in the order they were added
+  TaskContinuation *ordered = (TaskContinuation *)NULL;
+  while (continuations != (TaskContinuation *)NULL) {
+    TaskContinuation *const next = continuations->next;
+    continuations->next = ordered;
+    ordered = continuations;
+    continuations = next;
+  }
+  while (ordered != (TaskContinuation *)NULL) {
+    TaskContinuation *const next = ordered->next; // run may free ordered
+    ordered->run(ordered);
+    ordered = next;
+  }
+  errno = 0;
+  return errno;
+}
+
+bool task_isCompleted(const Task *const task) {
+  return atomic_load_explicit(&task->state, memory_order_acquire) ==
+         task_Completed;
+}
+
+int task_then(Task *const antecedent, Task *const continuation,
+              struct ThreadPool *const tp) {
+  const char fooName[] = "task_then";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (antecedent == (Task *)NULL) {
+    fprintf(stderr,
+            "argument 'antecedent' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (continuation == (Task *)NULL) {
+    fprintf(stderr,
+            "argument 'continuation' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  continuation->thenPool = tp;
+  task_pushContinuation(antecedent, &continuation->thenNode);
+  return errno;
+}
+
+int task_whenAll(Task *const *const tasks, const size_t numTasks,
+                 Task *const continuation, struct ThreadPool *const tp) {
+  const char fooName[] = "task_whenAll";
+
+  // Argument Validity Checks
+  errno = task_checkJoinArgs(fooName, tasks, numTasks, continuation);
+  if (errno != 0) {
+    return errno;
+  }
+
+  // nothing to wait on
+  if (numTasks == 0) {
+    return task_schedule(continuation, tp);
+  }
+  return task_join(tasks, numTasks, numTasks, continuation, tp);
+}
+
+int task_whenAny(Task *const *const tasks, const size_t numTasks,
+                 Task *const continuation, struct ThreadPool *const tp) {
+  const char fooName[] = "task_whenAny";
+
+  // Argument Validity Checks
+  errno = task_checkJoinArgs(fooName, tasks, numTasks, continuation);
+  if (errno != 0) {
+    return errno;
+  }
+  if (numTasks == 0) {
+    fprintf(stderr, "argument 'numTasks' of %s must be greater than 0\n",
+            fooName);
+    errno = EINVAL;
+    return errno;
+  }
+
+  // later arrivals take remaining past zero, so only the first fires
+  return task_join(tasks, numTasks, 1, continuation, tp);
+}
+
+int task_cancel(Task *const task) {
+  const char fooName[] = "task_cancel";
+
+  // Argument Validity Check
+  errno = 0;
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  atomic_store(&task->cancelled, true);
+  return errno;
+}
+
+void task_awaitPool(Task *const task) {
+  // Announce a sleeper through AWAITED so task_letGo only makes a syscall
+  // when needed
+  unsigned ownership =
+      atomic_load_explicit(&task->ownership, memory_order_acquire);
+  while ((ownership & TASK_OWNERSHIP_FINISHING) != 0) {
+    if ((ownership & TASK_OWNERSHIP_AWAITED) == 0 &&
+        !atomic_compare_exchange_weak_explicit(
+            &task->ownership, &ownership, ownership | TASK_OWNERSHIP_AWAITED,
+            memory_order_acquire, memory_order_acquire)) {
+      continue; // ownership reloaded by failed exchange
+    }
+    task_futexWait(&task->ownership, ownership | TASK_OWNERSHIP_AWAITED);
+    ownership = atomic_load_explicit(&task->ownership, memory_order_acquire);
+  }
+}
+
+void task_letGo(Task *const task) {
+  // As in task_markCompleted, waking after task may be reused is harmless
+  const unsigned ownership = atomic_fetch_and_explicit(
+      &task->ownership, ~(TASK_OWNERSHIP_FINISHING | TASK_OWNERSHIP_AWAITED),
+      memory_order_release);
+  if ((ownership & TASK_OWNERSHIP_AWAITED) != 0) {
+    task_futexWakeAll(&task->ownership);
+  }
+}
+
+int task_getResult(Task *const task) {
+  const char fooName[] = "tp_getTaskResult";
+
+  // Argument Validity Check
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "Argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  // Wait for result to become available, announcing a sleeper through state
+  // so task_markCompleted only makes a syscall when needed
+  errno = 0;
+  unsigned state = atomic_load_explicit(&task->state, memory_order_acquire);
+  while (state != task_Completed) {
+    if (state == task_Pending &&
+        !atomic_compare_exchange_weak_explicit(
+            &task->state, &state, task_Waiting, memory_order_acquire,
+            memory_order_acquire)) {
+      continue; // state reloaded by failed exchange
+    }
+    errno = task_futexWait(&task->state, task_Waiting);
+    if (errno != 0) {
+      fprintf(stderr,
+              "Encountered error while waiting on task to become available "
+              "in %s\n",
+              fooName);
+      return errno;
+    }
+    state = atomic_load_explicit(&task->state, memory_order_acquire);
+  }
+  task_awaitPool(task);
+  return errno;
+}
@@ -0,0 +1,64 @@
+#pragma once
+/**
+ * @file task_queue.h
+ * @author Justen Di Ruscio
+ * @brief Operations on a TaskQueue, a FIFO of Tasks linked through their next
+ * member. A Task is in at most one such structure at a time, so pushing and
+ * popping never allocate.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stddef.h>
+
+#include <jd/threadpool.h>
+
+/**
+ * @brief Initializes an empty queue
+ *
+ * @param tq queue to initialize
+ */
+static inline void taskQueue_init(TaskQueue *const tq) {
+  tq->head = (Task *)NULL;
+  tq->tail = (Task *)NULL;
+  tq->length = 0;
+}
+
+/**
+ * @brief Appends task to the back of tq, overwriting task's next link
+ *
+ * @param tq queue to push onto
+ * @param task task to push
+ */
+static inline void taskQueue_push(TaskQueue *const tq, Task *const task) {
+  task->next = (Task *)NULL;
+  if (tq->tail == (Task *)NULL) {
+    tq->head = task;
+  } else {
+    tq->tail->next = task;
+  }
+  tq->tail = task;
+  ++tq->length;
+}
+
+/**
+ * @brief Removes the front task of tq
+ *
+ * @param tq queue to pop from
+ * @return Task* front task or NULL when empty
+ */
+static inline Task *taskQueue_pop(TaskQueue *const tq) {
+  Task *const task = tq->head;
+  if (task == (Task *)NULL) {
+    return task;
+  }
+  tq->head = task->next;
+  if (tq->head == (Task *)NULL) {
+    tq->tail = (Task *)NULL;
+  }
+  --tq->length;
+  return task;
+}
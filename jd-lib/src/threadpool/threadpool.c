@@ -0,0 +1,1577 @@
+/**
+ * @file threadpool.c
+ * @author Justen Di Ruscio
+ * @brief Definitions for expanding thread pool
+ * @version 0.1
+ * @date 2021-03-20
+ *
+ * @copyright Copyright (c) 2021
+ *
+ */
+#define _GNU_SOURCE
+
+#include <jd/threadpool.h>
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "jd/instrument.h"
+#include "jd/queue.h"
+#include "threadpool_private.h"
+
+// worker state of the calling thread when it belongs to a work-stealing pool
+static _Thread_local TpWorker *currentWorker = (TpWorker *)NULL;
+
+// ==================== PRIVATE FUNCTIONS ===============
+ThreadPoolConfig tp_defaultConfig() {
+  ThreadPoolConfig config = {.numInitThreads = 0,
+                             .mode = tp_SharedQueue,
+                             .minThreads = 0,
+                             .maxThreads = 0,
+                             .idleTimeoutMs = 0};
+  return config;
+}
+
+int tp_init(ThreadPool *const tp, const unsigned numInitThreads) {
+  ThreadPoolConfig config = tp_defaultConfig();
+  config.numInitThreads = numInitThreads;
+  return tp_initConfig(tp, &config);
+}
+
+int tp_initConfig(ThreadPool *const tp, const ThreadPoolConfig *const config) {
+  const char fooName[] = "tp_initConfig";
+
+  // Argument Validity Check
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (config == (ThreadPoolConfig *)NULL) {
+    fprintf(stderr, "argument 'config' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  const unsigned modeMaxThreads =
+      config->mode == tp_WorkStealing ? TP_MAX_WORKERS : UINT_MAX;
+  const unsigned maxThreads =
+      config->maxThreads == 0 ? modeMaxThreads : config->maxThreads;
+  if (maxThreads > modeMaxThreads || config->minThreads > maxThreads ||
+      config->numInitThreads > maxThreads) {
+    fprintf(stderr,
+            "argument 'config' of %s must satisfy numInitThreads, minThreads "
+            "<= maxThreads <= %u\n",
+            fooName, modeMaxThreads);
+    errno = EINVAL;
+    return errno;
+  }
+
+  tp->running = true;
+  tp->mode = config->mode;
+  tp->minThreads = config->minThreads;
+  tp->maxThreads = maxThreads;
+  tp->idleTimeoutMs = config->idleTimeoutMs;
+  atomic_init(&tp->numIdleThreads, 0);
+  atomic_init(&tp->numThreads, 0);
+  atomic_init(&tp->numWorkers, 0);
+  atomic_init(&tp->numSleeping, 0);
+  atomic_init(&tp->numDequeTasks, 0);
+  atomic_init(&tp->peakThreads, 0);
+  atomic_init(&tp->tasksCompleted, 0);
+  atomic_init(&tp->threadsReaped, 0);
+  atomic_init(&tp->totalQueueWaitNs, 0);
+  atomic_init(&tp->maxQueueWaitNs, 0);
+  tp->workers = (struct TpWorker **)NULL;
+  tp->timers = (struct TimerWheel *)NULL;
+  tp->timerRunning = false;
+  tp->timerStopped = false;
+  tp->timerWakeTick = 0;
+  tp->freeTasks = (Task *)NULL;
+  tp->numFreeTasks = 0;
+
+  // Initialize condition variables on the monotonic clock for timeouts
+  pthread_condattr_t condAttr;
+  errno = pthread_condattr_init(&condAttr);
+  if (errno == 0) {
+    errno = pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+  }
+  if (errno == 0) {
+    errno = pthread_cond_init(&tp->taskAvailable, &condAttr);
+  }
+  if (errno == 0) {
+    errno = pthread_cond_init(&tp->timersChanged, &condAttr);
+  }
+  pthread_condattr_destroy(&condAttr);
+  if (errno != 0) {
+    fprintf(stderr,
+            "Failed to initialize condition variable for thread pool in %s\n",
+            fooName);
+    return errno;
+  }
+
+  // Initialize mutex for the timer wheel
+  errno = pthread_mutex_init(&tp->timerMutex, NULL);
+  if (errno != 0) {
+    fprintf(stderr, "Failed to initialize timer mutex for thread pool in %s\n",
+            fooName);
+    return errno;
+  }
+
+  // Initialize mutex for tasks
+  errno = pthread_mutex_init(&tp->taskMutex, NULL);
+  if (errno != 0) {
+    fprintf(stderr, "Failed to initialize task mutex for thread pool in %s\n",
+            fooName);
+    return errno;
+  }
+
+  // Initialize mutex for the freelist of released tasks
+  errno = pthread_mutex_init(&tp->freeTasksMutex, NULL);
+  if (errno != 0) {
+    fprintf(stderr,
+            "Failed to initialize free task mutex for thread pool in %s\n",
+            fooName);
+    return errno;
+  }
+
+  // Construct empty queue of tasks
+  taskQueue_init(&tp->waitingTasks);
+
+  // Reserve slots for the workers' deques, which thieves scan without locking
+  if (tp->mode == tp_WorkStealing) {
+    tp->workers = calloc(TP_MAX_WORKERS, sizeof(struct TpWorker *));
+    if (tp->workers == (struct TpWorker **)NULL) {
+      fprintf(stderr, "Failed to allocate work-stealing workers in %s\n",
+              fooName);
+      return errno; // errno set by calloc
+    }
+  }
+
+  // Construct and store initial threads, locking since spawned threads may
+  // already be reaping themselves
+  tp->threads = q_constructEmpty(sizeof(pthread_t));
+  tp->exitedThreads = q_constructEmpty(sizeof(pthread_t));
+  const unsigned numInitThreads = config->numInitThreads > config->minThreads
+                                      ? config->numInitThreads
+                                      : config->minThreads;
+  errno = tp_lockTaskMutex(tp);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking mutex to spawn initial threads in %s\n",
+            fooName);
+    return errno;
+  }
+  for (unsigned int threadNum = 0; threadNum < numInitThreads; ++threadNum) {
+    const bool spawned = tp_spawnThread(tp);
+    if (!spawned) {
+      fprintf(stderr, "Failed to spawn new pthread for thread pool in %s\n",
+              fooName);
+      const int spawnErr = errno;
+      pthread_mutex_unlock(&tp->taskMutex);
+      errno = spawnErr;
+      return errno; // errno set by tp_spawnThread
+    }
+  }
+  errno = pthread_mutex_unlock(&tp->taskMutex);
+
+  return errno;
+}
+
+bool tp_destroy(ThreadPool *const tp) {
+  const char fooName[] = "tp_destroy";
+
+  // Return if there's nothing to destroy
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    return true;
+  }
+
+  // Stop timer thread so no more delayed tasks come due
+  errno = pthread_mutex_lock(&tp->timerMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking timer mutex in %s\n", fooName);
+    return false;
+  }
+  const bool timerRunning = tp->timerRunning;
+  tp->timerRunning = false;
+  tp->timerStopped = true;
+  pthread_cond_signal(&tp->timersChanged);
+  errno = pthread_mutex_unlock(&tp->timerMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure unlocking timer mutex in %s\n", fooName);
+    return false;
+  }
+  if (timerRunning) {
+    errno = pthread_join(tp->timerThread, NULL);
+    if (errno != 0) {
+      fprintf(stderr, "Failure joining timer thread in %s\n", fooName);
+      return false;
+    }
+  }
+
+  // Stop and unblock all threads. running is cleared under taskMutex so no
+  // thread can check it, then miss the broadcast before waiting. Threads
+  // finish the tasks already queued before exiting.
+  errno = tp_lockTaskMutex(tp);
+  if (errno != 0) {
+    fprintf(stderr,
+            "Failure locking mutex in %s to unblock all threads in pool\n",
+            fooName);
+    return false;
+  }
+  tp->running = false;
+  const int unblockErr = pthread_cond_broadcast(&tp->taskAvailable);
+  errno = pthread_mutex_unlock(&tp->taskMutex);
+  if (errno != 0) {
+    fprintf(stderr,
+            "Failure unlocking mutex in %s to unblock all threads in pool\n",
+            fooName);
+    return false;
+  }
+  if (unblockErr != 0) {
+    fprintf(stderr,
+            "Failure unblocking all waiting threads with "
+            "pthread_cond_broadcast in %s\n",
+            fooName);
+    errno = unblockErr;
+    return false;
+  }
+
+  // Join every thread. Each is taken from threads under taskMutex, since
+  // threads reaped until running was cleared move themselves to exitedThreads
+  while (true) {
+    errno = tp_lockTaskMutex(tp);
+    if (errno != 0) {
+      fprintf(stderr, "Failure locking mutex to take a thread in %s\n",
+              fooName);
+      return false;
+    }
+    pthread_t thread;
+    const bool taken = jd_ok(q_tryPop(&tp->threads, &thread));
+    errno = pthread_mutex_unlock(&tp->taskMutex);
+    if (errno != 0) {
+      fprintf(stderr, "Failure unlocking mutex after taking a thread in %s\n",
+              fooName);
+      return false;
+    }
+    if (!taken) {
+      break;
+    }
+    errno = pthread_join(thread, NULL);
+    if (errno != 0) {
+      fprintf(stderr, "Failure joining thread from thread queue in %s\n",
+              fooName);
+      return false;
+    }
+  }
+
+  // Join threads that were reaped but not yet joined
+  errno = tp_joinExited(tp);
+  if (errno != 0) {
+    fprintf(stderr, "Failure joining reaped threads in %s\n", fooName);
+    return false;
+  }
+  q_freeElements(&tp->threads);
+  q_freeElements(&tp->exitedThreads);
+
+  // Free work-stealing workers once no thread can steal from them
+  if (tp->workers != (struct TpWorker **)NULL) {
+    const unsigned numWorkers = atomic_load(&tp->numWorkers);
+    for (unsigned wIdx = 0; wIdx < numWorkers; ++wIdx) {
+      wsDeque_destroy(&tp->workers[wIdx]->deque);
+      free(tp->workers[wIdx]);
+    }
+    free(tp->workers);
+    tp->workers = (struct TpWorker **)NULL;
+  }
+
+  // Cancel the delayed and periodic tasks still in the timer wheel, completing
+  // them with ECANCELED so their waiters wake and released blocks recycle
+  errno = tp_cancelTimers(tp);
+  if (errno != 0) {
+    fprintf(stderr, "Failure cancelling pending timers in %s\n", fooName);
+    return false;
+  }
+  free(tp->timers);
+  tp->timers = (struct TimerWheel *)NULL;
+  pthread_cond_destroy(&tp->timersChanged);
+  pthread_mutex_destroy(&tp->timerMutex);
+
+  // Free released tasks kept for reuse
+  while (tp->freeTasks != (Task *)NULL) {
+    Task *const next = tp->freeTasks->next;
+    free(tp->freeTasks);
+    tp->freeTasks = next;
+  }
+  tp->numFreeTasks = 0;
+  pthread_mutex_destroy(&tp->freeTasksMutex);
+
+  // Destroy condition variable
+  const int err1 = pthread_cond_destroy(&tp->taskAvailable);
+  if (err1 != 0) {
+    fprintf(stderr,
+            "Failure destroying thread pool's condition variable in %s\n",
+            fooName);
+  }
+
+  // Destroy mutexes
+  const int err2 = pthread_mutex_destroy(&tp->taskMutex);
+  if (err2 != 0) {
+    fprintf(stderr, "Failure destroying thread pool's task mutex in %s\n",
+            fooName);
+  }
+
+  errno = err1 != 0 ? err1 : err2;
+  return errno == 0;
+}
+
+// non-reentrant
+bool tp_spawnThread(ThreadPool *const tp) {
+  const char fooName[] = "tp_spawnThread";
+
+  // Argument Validity Check
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // Join reaped threads so their stacks are released before growing again
+  errno = tp_joinExited(tp);
+  if (errno != 0) {
+    fprintf(stderr, "Failure joining reaped threads in %s\n", fooName);
+    return false;
+  }
+
+  const unsigned numThreads = atomic_load(&tp->numThreads);
+  if (numThreads >= tp->maxThreads) {
+    fprintf(stderr, "Thread pool cannot exceed %u threads in %s\n",
+            tp->maxThreads, fooName);
+    errno = EAGAIN;
+    return false;
+  }
+
+  pthread_t thread = 0;
+
+  // Work-stealing threads get their own deque, published before they start.
+  // Workers of reaped threads are reused, since thieves may still scan them
+  void *(*startFunction)(void *) = workerFunction;
+  void *startArg = tp;
+  if (tp->mode == tp_WorkStealing) {
+    const unsigned numWorkers = atomic_load(&tp->numWorkers);
+    TpWorker *reusable = (TpWorker *)NULL;
+    for (unsigned wIdx = 0; wIdx < numWorkers; ++wIdx) {
+      if (!tp->workers[wIdx]->active) {
+        reusable = tp->workers[wIdx];
+        break;
+      }
+    }
+    if (reusable != (TpWorker *)NULL) {
+      reusable->active = true;
+      startArg = reusable;
+    } else {
+      startArg = tp_newWorker(tp);
+      if (startArg == (void *)NULL) {
+        return false; // errno set by tp_newWorker
+      }
+    }
+    startFunction = stealingWorkerFunction;
+  }
+
+  // Create thread with default attributes
+  // thread is joinable (non-detached) by default
+  errno = pthread_create(&thread, NULL, startFunction, startArg);
+  if (errno != 0) {
+    fprintf(stderr, "Failed to create new pthread in %s\n", fooName);
+    if (tp->mode == tp_WorkStealing) {
+      ((TpWorker *)startArg)->active = false;
+    }
+    return false;
+  }
+
+  // Store thread in threadpool's queue
+  const bool enqueued = q_enqueue(&tp->threads, &thread);
+  if (!enqueued) {
+    fprintf(stderr, "Failed to add new pthread to thread pool in %s\n",
+            fooName);
+    return false; // errno set by q_enqueue
+  }
+  ++tp->numIdleThreads;
+  atomic_store(&tp->numThreads, numThreads + 1);
+  if (numThreads + 1 > atomic_load(&tp->peakThreads)) {
+    atomic_store(&tp->peakThreads, numThreads + 1);
+  }
+
+  return true;
+}
+
+int tp_enqueueImmediate(ThreadPool *const tp, Task *const task) {
+  const char fooName[] = "tp_enqueueImmediate";
+
+  // Argument Validity Check
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  task->enqueuedNs = tp_nowNs();
+  tp_holdTask(task);
+
+  // Push onto the calling worker's own deque when called from within the pool
+  if (currentWorker != (TpWorker *)NULL && currentWorker->tp == tp) {
+    return tp_enqueueLocal(tp, currentWorker, task);
+  }
+
+  // obtain lock to update waiting task queue and spawn threads
+  errno = tp_lockTaskMutex(tp);
+  if (errno != 0) {
+    fprintf(stderr,
+            "Encountered error while attempting to lock mutex to modify "
+            "thread pool's queues in %s\n",
+            fooName);
+    return errno;
+  }
+
+  // Spawn new thread if every idle thread is already claimed by a waiting task,
+  // unless at the limit, in which case the task waits in waitingTasks. When
+  // spawning fails but other threads exist, the task waits for one of them
+  if (tp->waitingTasks.length >= tp->numIdleThreads &&
+      tp->numThreads < tp->maxThreads) {
+    const bool spawned = tp_spawnThread(tp);
+    if (!spawned && atomic_load(&tp->numThreads) == 0) {
+      fprintf(stderr, "Failed spawning new thread pool thread in %s\n",
+              fooName);
+      const int spawnErr = errno; // errno set by tp_spawnThread
+      pthread_mutex_unlock(&tp->taskMutex);
+      atomic_fetch_and(&task->ownership, ~TP_TASK_HELD); // never queued
+      errno = spawnErr;
+      return errno;
+    }
+    if (!spawned) {
+      fprintf(stderr,
+              "Failed spawning new thread pool thread in %s; task waits for "
+              "an existing thread\n",
+              fooName);
+    }
+  }
+
+  // Add task to queue
+  taskQueue_push(&tp->waitingTasks, task);
+  JD_COUNT(jd_counterTasksEnqueued, 1);
+  JD_COUNT_MAX(jd_counterQueueDepthPeak, tp->waitingTasks.length);
+  JD_TRACE_VALUE("waitingTasks", tp->waitingTasks.length);
+
+  // Notify that a task is available in waitingTasks queue
+  const int signalErr = pthread_cond_signal(&tp->taskAvailable);
+  errno = pthread_mutex_unlock(&tp->taskMutex);
+  if (errno != 0) {
+    fprintf(stderr,
+            "Encountered error while unlocking mutex after modifying "
+            "thread pool's queues in %s\n",
+            fooName);
+  }
+  if (signalErr != 0) {
+    fprintf(stderr,
+            "Error while signaling a task is available for thread pool in %s\n",
+            fooName);
+    errno = signalErr;
+  }
+
+  return errno;
+}
+
+int tp_enqueueDelayed(ThreadPool *const tp, Task *const task,
+                      const unsigned delayMs) {
+  const char fooName[] = "tp_enqueueDelayed";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  task->periodMs = 0;
+  task->timerExpiry = tp_nowMs() + delayMs;
+  return tp_scheduleTimer(tp, task);
+}
+
+int tp_enqueuePeriodic(ThreadPool *const tp, Task *const task,
+                       const unsigned delayMs, const unsigned periodMs) {
+  const char fooName[] = "tp_enqueuePeriodic";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (periodMs == 0) {
+    fprintf(stderr, "argument 'periodMs' of %s must be greater than 0\n",
+            fooName);
+    errno = EINVAL;
+    return errno;
+  }
+
+  task->periodMs = periodMs;
+  task->timerExpiry = tp_nowMs() + delayMs;
+  return tp_scheduleTimer(tp, task);
+}
+
+int tp_getStats(ThreadPool *const tp, ThreadPoolStats *const stats) {
+  const char fooName[] = "tp_getStats";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (stats == (ThreadPoolStats *)NULL) {
+    fprintf(stderr, "argument 'stats' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  // waitingTasks is only read under taskMutex
+  errno = tp_lockTaskMutex(tp);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking mutex to read pending tasks in %s\n",
+            fooName);
+    return errno;
+  }
+  stats->numPending = tp->waitingTasks.length;
+  errno = pthread_mutex_unlock(&tp->taskMutex);
+
+  stats->numThreads = atomic_load(&tp->numThreads);
+  stats->numIdleThreads = atomic_load(&tp->numIdleThreads);
+  stats->peakThreads = atomic_load(&tp->peakThreads);
+  stats->tasksCompleted = atomic_load(&tp->tasksCompleted);
+  stats->threadsReaped = atomic_load(&tp->threadsReaped);
+  stats->totalQueueWaitNs = atomic_load(&tp->totalQueueWaitNs);
+  stats->maxQueueWaitNs = atomic_load(&tp->maxQueueWaitNs);
+  return errno;
+}
+
+Task *tp_acquireTask(ThreadPool *const tp, const size_t size) {
+  const char fooName[] = "tp_acquireTask";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return (Task *)NULL;
+  }
+  if (size < sizeof(Task) || size > TP_TASK_BLOCK_SIZE) {
+    fprintf(stderr,
+            "argument 'size' of %s must be between sizeof(Task) and %u\n",
+            fooName, TP_TASK_BLOCK_SIZE);
+    errno = EINVAL;
+    return (Task *)NULL;
+  }
+
+  // Reuse a released block when one is available
+  errno = pthread_mutex_lock(&tp->freeTasksMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking free task mutex in %s\n", fooName);
+    return (Task *)NULL;
+  }
+  Task *task = tp->freeTasks;
+  if (task != (Task *)NULL) {
+    tp->freeTasks = task->next;
+    --tp->numFreeTasks;
+  }
+  errno = pthread_mutex_unlock(&tp->freeTasksMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure unlocking free task mutex in %s\n", fooName);
+    return (Task *)NULL;
+  }
+
+  // Otherwise allocate a new one
+  if (task == (Task *)NULL) {
+    task = malloc(TP_TASK_BLOCK_SIZE);
+    if (task == (Task *)NULL) {
+      fprintf(stderr, "Failure allocating task in %s\n", fooName);
+      return task; // errno set by malloc
+    }
+    JD_COUNT_ALLOCATION(TP_TASK_BLOCK_SIZE);
+  }
+  atomic_init(&task->ownership, 0);
+  return task;
+}
+
+int tp_releaseTask(ThreadPool *const tp, Task *const task) {
+  const char fooName[] = "tp_releaseTask";
+
+  // Argument Validity Checks
+  errno = 0;
+  if (tp == (ThreadPool *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+  if (task == (Task *)NULL) {
+    fprintf(stderr, "argument 'task' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return errno;
+  }
+
+  // Whichever of this and the pool letting go comes second recycles the task
+  const unsigned ownership =
+      atomic_fetch_or(&task->ownership, TP_TASK_RELEASED);
+  if ((ownership & TP_TASK_HELD) != 0) {
+    return errno;
+  }
+
+  // The pool let go but may still be marking task completed, so it's only
+  // reused once the pool clears FINISHING, whoever else completed task
+  if ((ownership & TP_TASK_FINISHING) != 0) {
+    task_awaitPool(task);
+  }
+  return tp_recycleTask(tp, task);
+}
+
+// ==================== PRIVATE FUNCTIONS ===============
+static uint64_t tp_nowNs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t tp_nowMs() { return tp_nowNs() / 1000000u; }
+
+static int tp_lockTaskMutex(ThreadPool *const tp) {
+#if defined(JD_INSTRUMENT)
+  JD_COUNT(jd_counterTaskMutexLocks, 1);
+  const int tryErr = pthread_mutex_trylock(&tp->taskMutex);
+  if (tryErr != EBUSY) {
+    return tryErr;
+  }
+  JD_COUNT(jd_counterTaskMutexContended, 1);
+  const uint64_t start = tp_nowNs();
+  const int lockErr = pthread_mutex_lock(&tp->taskMutex);
+  JD_COUNT(jd_counterTaskMutexWaitNs, tp_nowNs() - start);
+  return lockErr;
+#else
+  return pthread_mutex_lock(&tp->taskMutex);
+#endif
+}
+
+static int tp_scheduleTimer(ThreadPool *const tp, Task *const task) {
+  const char fooName[] = "tp_scheduleTimer";
+
+  errno = pthread_mutex_lock(&tp->timerMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking timer mutex in %s\n", fooName);
+    return errno;
+  }
+
+  // Refuse tasks once tp_destroy stopped the timer thread for good
+  if (tp->timerStopped) {
+    pthread_mutex_unlock(&tp->timerMutex);
+    errno = ECANCELED;
+    return errno;
+  }
+
+  // Start the timer thread on first use
+  if (!tp->timerRunning) {
+    if (tp->timers == (struct TimerWheel *)NULL) {
+      tp->timers = malloc(sizeof(TimerWheel));
+      if (tp->timers == (struct TimerWheel *)NULL) {
+        fprintf(stderr, "Failure allocating timer wheel in %s\n", fooName);
+        const int allocErr = errno; // errno set by malloc
+        pthread_mutex_unlock(&tp->timerMutex);
+        errno = allocErr;
+        return errno;
+      }
+      tw_init(tp->timers, tp_nowMs());
+    }
+    errno = pthread_create(&tp->timerThread, NULL, timerFunction, tp);
+    if (errno != 0) {
+      fprintf(stderr, "Failure creating timer thread in %s\n", fooName);
+      const int createErr = errno;
+      pthread_mutex_unlock(&tp->timerMutex);
+      errno = createErr;
+      return errno;
+    }
+    tp->timerRunning = true;
+  }
+
+  // Wake the timer thread only when task is due before it planned to wake
+  tp_holdTask(task);
+  tw_insert(tp->timers, task);
+  int signalErr = 0;
+  if (task->timerExpiry < tp->timerWakeTick) {
+    tp->timerWakeTick = task->timerExpiry;
+    signalErr = pthread_cond_signal(&tp->timersChanged);
+  }
+  errno = pthread_mutex_unlock(&tp->timerMutex);
+  if (signalErr != 0) {
+    fprintf(stderr, "Failure signaling timer thread in %s\n", fooName);
+    errno = signalErr;
+  }
+  return errno;
+}
+
+static void tp_holdTask(Task *const task) {
+  atomic_fetch_or(&task->ownership, TP_TASK_HELD);
+}
+
+static int tp_recycleTask(ThreadPool *const tp, Task *const task) {
+  const char fooName[] = "tp_recycleTask";
+
+  errno = pthread_mutex_lock(&tp->freeTasksMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking free task mutex in %s\n", fooName);
+    return errno;
+  }
+  const bool keep = tp->numFreeTasks < TP_MAX_FREE_TASKS;
+  if (keep) {
+    task->next = tp->freeTasks;
+    tp->freeTasks = task;
+    ++tp->numFreeTasks;
+  }
+  errno = pthread_mutex_unlock(&tp->freeTasksMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure unlocking free task mutex in %s\n", fooName);
+  }
+
+  if (!keep) {
+    free(task);
+  }
+  return errno;
+}
+
+/**
+ * @brief Lets go of task after its last use, then marks it completed,
+ * recycling it if it was released in the meantime. Otherwise FINISHING, set
+ * while letting go, is cleared as the last touch of task, which its waiters
+ * and releaser wait for before reusing it. Sets errno upon error.
+ *
+ * @param tp thread pool holding task
+ * @param task task the pool is done with
+ * @return int errno
+ */
+static int tp_completeTask(ThreadPool *const tp, Task *const task) {
+  const char fooName[] = "tp_completeTask";
+
+  // HELD is set, so this clears it and sets FINISHING
+  const unsigned ownership = atomic_fetch_xor(
+      &task->ownership, TP_TASK_HELD | TP_TASK_FINISHING);
+  errno = task_markCompleted(task);
+  if (errno != 0) {
+    fprintf(stderr, "Unable to mark task as completed in %s\n", fooName);
+  }
+  if ((ownership & TP_TASK_RELEASED) != 0) {
+    return tp_recycleTask(tp, task);
+  }
+
+  // Last touch of task, after which its waiters and releaser may reuse it
+  const int completeErr = errno;
+  task_letGo(task);
+  errno = completeErr;
+  return errno;
+}
+
+static int tp_cancelTimers(ThreadPool *const tp) {
+  const char fooName[] = "tp_cancelTimers";
+
+  errno = pthread_mutex_lock(&tp->timerMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking timer mutex in %s\n", fooName);
+    return errno;
+  }
+  Task *pending = tp->timers != (struct TimerWheel *)NULL
+                      ? tw_drain(tp->timers)
+                      : (Task *)NULL;
+  errno = pthread_mutex_unlock(&tp->timerMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure unlocking timer mutex in %s\n", fooName);
+    return errno;
+  }
+
+  int completeErr = 0;
+  while (pending != (Task *)NULL) {
+    Task *const next = pending->next;
+    pending->fooErrno = ECANCELED;
+    if (tp_completeTask(tp, pending) != 0) {
+      completeErr = errno; // errno set by tp_completeTask
+    }
+    pending = next;
+  }
+  errno = completeErr;
+  return errno;
+}
+
+/**
+ * @brief Adds the time task spent queued, up until now, to tp's statistics
+ *
+ * @param tp thread pool task was taken from
+ * @param task task about to run
+ */
+static void tp_recordQueueWait(ThreadPool *const tp, const Task *const task) {
+  const uint64_t now = tp_nowNs();
+  const uint64_t waitNs = now > task->enqueuedNs ? now - task->enqueuedNs : 0;
+  atomic_fetch_add_explicit(&tp->totalQueueWaitNs, waitNs,
+                            memory_order_relaxed);
+  uint_least64_t maxWaitNs =
+      atomic_load_explicit(&tp->maxQueueWaitNs, memory_order_relaxed);
+  while (waitNs > maxWaitNs &&
+         !atomic_compare_exchange_weak_explicit(&tp->maxQueueWaitNs,
+                                                &maxWaitNs, waitNs,
+                                                memory_order_relaxed,
+                                                memory_order_relaxed)) {
+  }
+  JD_COUNT(jd_counterTaskWaitNs, waitNs);
+}
+
+/**
+ * @brief Runs task on the calling thread of tp unless it's been cancelled,
+ * then either reschedules it, when periodic, or marks it completed. Sets errno
+ * upon error.
+ *
+ * @param tp thread pool task was taken from
+ * @param task task to run
+ * @return int errno
+ */
+static int tp_runTask(ThreadPool *const tp, Task *const task) {
+  const char fooName[] = "tp_runTask";
+  tp_recordQueueWait(tp, task);
+
+  // Execute extracted task and store result in task
+  if (!atomic_load(&task->cancelled)) {
+    JD_TRACE_SCOPE("task");
+#if defined(JD_INSTRUMENT)
+    const uint64_t runStartNs = tp_nowNs();
+#endif
+    errno = task_execute(task);
+#if defined(JD_INSTRUMENT)
+    JD_COUNT(jd_counterTaskRunNs, tp_nowNs() - runStartNs);
+    JD_COUNT(jd_counterTasksRun, 1);
+#endif
+    if (errno != 0) {
+      fprintf(stderr, "Failure trying to execute task funciton in %s\n",
+              fooName);
+      return errno;
+    }
+  }
+  atomic_fetch_add(&tp->tasksCompleted, 1);
+
+  // Schedule next run of periodic task, skipping runs it fell behind on
+  if (task->periodMs != 0 && !atomic_load(&task->cancelled)) {
+    const uint64_t now = tp_nowMs();
+    task->timerExpiry += task->periodMs;
+    if (task->timerExpiry <= now) {
+      task->timerExpiry = now + task->periodMs;
+    }
+    errno = tp_scheduleTimer(tp, task);
+    if (errno != ECANCELED) {
+      return errno;
+    }
+    // tp is being destroyed, so stop the task instead, as tp_cancelTimers
+    // stops those not due yet
+    task->fooErrno = ECANCELED;
+  }
+
+  // Mark Task as completed when it finishes
+  return tp_completeTask(tp, task);
+}
+
+/**
+ * @brief Absolute time, on the monotonic clock, at which a thread starting to
+ * idle now may be reaped
+ *
+ * @param tp thread pool
+ * @return struct timespec deadline
+ */
+static struct timespec tp_idleDeadline(const ThreadPool *const tp) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_MONOTONIC, &deadline);
+  deadline.tv_sec += tp->idleTimeoutMs / 1000;
+  deadline.tv_nsec += (long)(tp->idleTimeoutMs % 1000) * 1000000;
+  if (deadline.tv_nsec >= 1000000000) {
+    deadline.tv_sec += 1;
+    deadline.tv_nsec -= 1000000000;
+  }
+  return deadline;
+}
+
+/**
+ * @brief Waits on taskAvailable, until deadline when idle threads may be
+ * reaped. Must hold taskMutex.
+ *
+ * @param tp thread pool
+ * @param deadline time to stop waiting at, ignored when idleTimeoutMs is 0
+ * @return int 0, ETIMEDOUT once deadline passed, or another errno upon error
+ */
+static int tp_waitForTask(ThreadPool *const tp,
+                          const struct timespec *const deadline) {
+  if (tp->idleTimeoutMs == 0) {
+    return pthread_cond_wait(&tp->taskAvailable, &tp->taskMutex);
+  }
+  return pthread_cond_timedwait(&tp->taskAvailable, &tp->taskMutex, deadline);
+}
+
+/**
+ * @brief Indicates whether an idle thread that timed out should exit. Must
+ * hold taskMutex.
+ *
+ * @param tp thread pool
+ * @return true more than minThreads threads are alive and tp is running
+ * @return false thread should keep waiting
+ */
+static bool tp_canReap(const ThreadPool *const tp) {
+  return tp->running && atomic_load(&tp->numThreads) > tp->minThreads;
+}
+
+/**
+ * @brief Removes the calling, idle thread from tp so it can exit; it's joined
+ * later by tp_joinExited. Must hold taskMutex. Sets errno upon error.
+ *
+ * @param tp thread pool the calling thread belongs to
+ * @return int errno
+ */
+static int tp_retireThread(ThreadPool *const tp) {
+  const char fooName[] = "tp_retireThread";
+  errno = 0;
+
+  const pthread_t self = pthread_self();
+  ListNode *node = tp->threads.elements.head;
+  while (node != (ListNode *)NULL &&
+         !pthread_equal(*(pthread_t *)node->data, self)) {
+    node = node->next;
+  }
+  if (node == (ListNode *)NULL) {
+    fprintf(stderr, "Calling thread doesn't belong to thread pool in %s\n",
+            fooName);
+    errno = EINVAL;
+    return errno;
+  }
+  if (!list_eraseNode(&tp->threads.elements, node)) {
+    fprintf(stderr, "Unable to remove thread from thread pool in %s\n",
+            fooName);
+    return errno; // errno set by list_eraseNode
+  }
+  if (!q_enqueue(&tp->exitedThreads, &self)) {
+    fprintf(stderr, "Unable to record exited thread in %s\n", fooName);
+    return errno; // errno set by q_enqueue
+  }
+
+  if (currentWorker != (TpWorker *)NULL) {
+    currentWorker->active = false;
+  }
+  atomic_fetch_sub(&tp->numThreads, 1);
+  atomic_fetch_sub(&tp->numIdleThreads, 1);
+  atomic_fetch_add(&tp->threadsReaped, 1);
+  return errno;
+}
+
+static int tp_joinExited(ThreadPool *const tp) {
+  const char fooName[] = "tp_joinExited";
+  errno = 0;
+
+  pthread_t thread;
+  while (jd_ok(q_tryPop(&tp->exitedThreads, &thread))) {
+    errno = pthread_join(thread, NULL);
+    if (errno != 0) {
+      fprintf(stderr, "Failure joining exited thread in %s\n", fooName);
+      return errno;
+    }
+  }
+  return errno;
+}
+
+static TpWorker *tp_newWorker(ThreadPool *const tp) {
+  const char fooName[] = "tp_newWorker";
+
+  const unsigned index = atomic_load(&tp->numWorkers);
+  if (index >= TP_MAX_WORKERS) {
+    fprintf(stderr, "Work-stealing pool cannot exceed %u threads in %s\n",
+            TP_MAX_WORKERS, fooName);
+    errno = EAGAIN;
+    return (TpWorker *)NULL;
+  }
+  TpWorker *const worker = malloc(sizeof(TpWorker));
+  if (worker == (TpWorker *)NULL) {
+    fprintf(stderr, "Failed to allocate work-stealing worker in %s\n",
+            fooName);
+    return (TpWorker *)NULL; // errno set by malloc
+  }
+  if (!wsDeque_init(&worker->deque, TP_DEQUE_INIT_CAPACITY)) {
+    fprintf(stderr, "Failed to initialize worker's deque in %s\n", fooName);
+    free(worker);
+    return (TpWorker *)NULL; // errno set by wsDeque_init
+  }
+  worker->tp = tp;
+  worker->index = index;
+  worker->randomState = 2463534242u + index * 2654435761u;
+  worker->active = true;
+  tp->workers[index] = worker;
+  atomic_store_explicit(&tp->numWorkers, index + 1, memory_order_release);
+  return worker;
+}
+
+/**
+ * @brief Wakes a sleeping thread of a work-stealing pool, if there is one, to
+ * take newly pushed work. Sets errno upon error.
+ *
+ * @param tp thread pool
+ * @return int errno
+ */
+static int tp_wakeSleeper(ThreadPool *const tp) {
+  const char fooName[] = "tp_wakeSleeper";
+  errno = 0;
+
+  // pairs with the fence in tp_sleepUntilWork so either the sleeper sees the
+  // pushed task or this sees the sleeper
+  WS_SEQ_CST_FENCE();
+  if (atomic_load_explicit(&tp->numSleeping,
+                           WS_FENCED(memory_order_relaxed)) == 0) {
+    return errno;
+  }
+
+  errno = tp_lockTaskMutex(tp);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking mutex to wake a thread in %s\n",
+            fooName);
+    return errno;
+  }
+  const int signalErr = pthread_cond_signal(&tp->taskAvailable);
+  errno = pthread_mutex_unlock(&tp->taskMutex);
+  if (signalErr != 0) {
+    fprintf(stderr, "Failure signaling a task is available in %s\n", fooName);
+    errno = signalErr;
+  }
+  return errno;
+}
+
+static int tp_enqueueLocal(ThreadPool *const tp, TpWorker *const worker,
+                           Task *const task) {
+  const char fooName[] = "tp_enqueueLocal";
+
+  // Counted before it's pushed, so a thief taking it can't count it first
+  const unsigned numDequeTasks = atomic_fetch_add(&tp->numDequeTasks, 1) + 1;
+  const bool pushed = wsDeque_push(&worker->deque, task);
+  if (!pushed) {
+    const int pushErr = errno; // errno set by wsDeque_push
+    atomic_fetch_sub(&tp->numDequeTasks, 1);
+    atomic_fetch_and(&task->ownership, ~TP_TASK_HELD); // never queued
+    fprintf(stderr, "Unable to push task onto worker's deque in %s\n",
+            fooName);
+    errno = pushErr;
+    return errno;
+  }
+  JD_COUNT(jd_counterTasksEnqueued, 1);
+
+  // From here task is enqueued, so failures are only reported: the calling
+  // worker is alive and drains its own deque, and a caller seeing an error
+  // would release task while a worker may still take it
+
+  // Spawn new thread if every idle thread is already claimed by a task in the
+  // deques, as tp_enqueueImmediate does for waitingTasks, unless at the limit.
+  // Takers stop counting as idle before they stop counting the task, so a
+  // task taken but not yet counted as taken still claims its taker
+  if (numDequeTasks > atomic_load(&tp->numIdleThreads) &&
+      atomic_load(&tp->numThreads) < tp->maxThreads) {
+    if (tp_lockTaskMutex(tp) != 0) {
+      fprintf(stderr,
+              "Failure locking mutex to spawn a thread in %s; task waits for "
+              "an existing thread\n",
+              fooName);
+    } else {
+      bool spawned = true;
+      if (atomic_load(&tp->numDequeTasks) >
+              atomic_load(&tp->numIdleThreads) &&
+          atomic_load(&tp->numThreads) < tp->maxThreads) {
+        spawned = tp_spawnThread(tp);
+      }
+      pthread_mutex_unlock(&tp->taskMutex);
+      if (!spawned) {
+        fprintf(stderr,
+                "Failed spawning new thread pool thread in %s; task waits for "
+                "an existing thread\n",
+                fooName);
+      }
+    }
+  }
+
+  tp_wakeSleeper(tp); // reports its own failures
+  errno = 0;
+  return errno;
+}
+
+/**
+ * @brief Picks the next victim for worker to steal from with xorshift
+ *
+ * @param worker stealing worker
+ * @param numWorkers number of workers in the pool
+ * @return unsigned index of victim in the pool's workers
+ */
+static unsigned tp_randomVictim(TpWorker *const worker,
+                                const unsigned numWorkers) {
+  unsigned x = worker->randomState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  worker->randomState = x;
+  return x % numWorkers;
+}
+
+/**
+ * @brief Attempts to steal a task from any other worker in the pool, starting
+ * from a random victim
+ *
+ * @param worker stealing worker
+ * @return Task* stolen task or NULL if every other deque is empty
+ */
+static Task *tp_steal(TpWorker *const worker) {
+  const ThreadPool *const tp = worker->tp;
+  const unsigned numWorkers =
+      atomic_load_explicit(&tp->numWorkers, memory_order_acquire);
+  if (numWorkers < 2) {
+    return (Task *)NULL;
+  }
+
+  const unsigned start = tp_randomVictim(worker, numWorkers);
+  for (unsigned offset = 0; offset < numWorkers; ++offset) {
+    TpWorker *const victim = tp->workers[(start + offset) % numWorkers];
+    if (victim == worker) {
+      continue;
+    }
+    bool lostRace = true;
+    while (lostRace) {
+      Task *const task = wsDeque_steal(&victim->deque, &lostRace);
+      if (task != (Task *)NULL) {
+        return task;
+      }
+    }
+  }
+  return (Task *)NULL;
+}
+
+/**
+ * @brief Indicates whether any worker's deque in the pool holds a task
+ *
+ * @param tp work-stealing thread pool
+ * @return true some deque is non-empty
+ * @return false every deque is empty
+ */
+static bool tp_dequesHaveWork(ThreadPool *const tp) {
+  const unsigned numWorkers =
+      atomic_load_explicit(&tp->numWorkers, memory_order_acquire);
+  for (unsigned wIdx = 0; wIdx < numWorkers; ++wIdx) {
+    if (wsDeque_size(&tp->workers[wIdx]->deque) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Removes the front task of tp's waitingTasks. Must hold taskMutex.
+ *
+ * @param tp thread pool
+ * @return Task* front task or NULL when empty
+ */
+static Task *tp_dequeueWaiting(ThreadPool *const tp) {
+  return taskQueue_pop(&tp->waitingTasks);
+}
+
+/**
+ * @brief Finds the next task for worker: its own deque first (LIFO), then
+ * other workers' deques, then the pool's waitingTasks. Sets errno upon error.
+ *
+ * @param worker worker looking for a task
+ * @param fromDeque out-parameter set to whether the task was in a deque
+ * @return Task* next task or NULL if there is none
+ */
+static Task *tp_findTask(TpWorker *const worker, bool *const fromDeque) {
+  const char fooName[] = "tp_findTask";
+  ThreadPool *const tp = worker->tp;
+  errno = 0;
+
+  *fromDeque = true;
+  Task *task = wsDeque_pop(&worker->deque);
+  if (task != (Task *)NULL) {
+    return task;
+  }
+  task = tp_steal(worker);
+  if (task != (Task *)NULL) {
+    return task;
+  }
+  *fromDeque = false;
+
+  errno = tp_lockTaskMutex(tp);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking mutex to take waiting task in %s\n",
+            fooName);
+    return (Task *)NULL;
+  }
+  task = tp_dequeueWaiting(tp);
+  const int dequeueErr = errno;
+  errno = pthread_mutex_unlock(&tp->taskMutex);
+  if (errno == 0) {
+    errno = dequeueErr;
+  }
+  return task;
+}
+
+/**
+ * @brief Blocks the calling worker until work may be available or the pool
+ * stops. Sets errno upon error.
+ *
+ * @param tp work-stealing thread pool
+ * @param shouldExit out-parameter set to true when the worker should exit
+ * @return int errno
+ */
+static int tp_sleepUntilWork(ThreadPool *const tp, bool *const shouldExit) {
+  const char fooName[] = "tp_sleepUntilWork";
+  *shouldExit = false;
+
+  errno = tp_lockTaskMutex(tp);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking mutex to wait for tasks in %s\n",
+            fooName);
+    return errno;
+  }
+
+  // announce sleeping before the final check for work; see tp_wakeSleeper
+  atomic_fetch_add(&tp->numSleeping, 1);
+  WS_SEQ_CST_FENCE();
+  struct timespec deadline = tp_idleDeadline(tp);
+  bool reap = false;
+  while (tp->running && tp->waitingTasks.length == 0 &&
+         !tp_dequesHaveWork(tp)) {
+    errno = tp_waitForTask(tp, &deadline);
+    if (errno == ETIMEDOUT) {
+      errno = 0;
+      if (tp_canReap(tp)) {
+        reap = tp->waitingTasks.length == 0 && !tp_dequesHaveWork(tp);
+        break;
+      }
+      deadline = tp_idleDeadline(tp);
+    } else if (errno != 0) {
+      fprintf(stderr, "Failure waiting on a task to become available in %s\n",
+              fooName);
+      break;
+    }
+  }
+  atomic_fetch_sub(&tp->numSleeping, 1);
+
+  *shouldExit = !tp->running && tp->waitingTasks.length == 0 &&
+          !tp_dequesHaveWork(tp);
+
+  // exit after idling for idleTimeoutMs while above minThreads
+  if (reap) {
+    errno = tp_retireThread(tp);
+    *shouldExit = errno == 0;
+  }
+
+  const int waitErr = errno;
+  errno = pthread_mutex_unlock(&tp->taskMutex);
+  if (waitErr != 0) {
+    errno = waitErr;
+  }
+  return errno;
+}
+
+void *stealingWorkerFunction(void *worker) {
+  const char fooName[] = "stealingWorkerFunction";
+
+  // Argument Validity Check
+  errno = 0;
+  if (worker == (void *)NULL) {
+    fprintf(stderr, "argument 'worker' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return (void *)(size_t)errno;
+  }
+
+  TpWorker *const self = (TpWorker *)worker;
+  ThreadPool *const tp_ = self->tp;
+  currentWorker = self;
+
+  while (true) {
+    bool fromDeque = false;
+    Task *const task = tp_findTask(self, &fromDeque);
+    if (errno != 0) {
+      fprintf(stderr, "Failure finding a task to run in %s\n", fooName);
+      break; // errno set by tp_findTask
+    }
+
+    // Sleep when there's no work anywhere in the pool
+    if (task == (Task *)NULL) {
+      bool shouldExit = false;
+      errno = tp_sleepUntilWork(tp_, &shouldExit);
+      if (errno != 0) {
+        fprintf(stderr, "Failure waiting for work in %s\n", fooName);
+        break;
+      }
+      if (shouldExit) {
+        break;
+      }
+      continue;
+    }
+
+    // Stop counting as idle before the task stops counting; see
+    // tp_enqueueLocal
+    atomic_fetch_sub(&tp_->numIdleThreads, 1);
+    if (fromDeque) {
+      atomic_fetch_sub(&tp_->numDequeTasks, 1);
+    }
+
+    // Run task, rescheduling it when periodic
+    errno = tp_runTask(tp_, task);
+    if (errno != 0) {
+      fprintf(stderr, "Failure running task in %s\n", fooName);
+      break;
+    }
+
+    atomic_fetch_add(&tp_->numIdleThreads, 1);
+  }
+
+  currentWorker = (TpWorker *)NULL;
+  return (void *)(size_t)errno;
+}
+
+/**
+ * @brief function each thread in pool runs to execute tasks
+ *
+ * @param tp thread pool
+ * @return void* errno
+ */
+void *workerFunction(void *tp) {
+  const char fooName[] = "workerFunction";
+
+  // Argument Validity Check
+  errno = 0;
+  if (tp == (void *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return (void *)(size_t)errno;
+  }
+
+  ThreadPool *tp_ = (ThreadPool *)tp;
+
+  while (true) {
+    // Obtain lock to wait for available task
+    errno = tp_lockTaskMutex(tp_);
+    if (errno != 0) {
+      fprintf(stderr,
+              "Encountered error while attempting to lock mutex in %s\n",
+              fooName);
+      break;
+    }
+
+    // Wait for task to become available, indicated
+    // by taskAvailable condition variable. Exit once idle for idleTimeoutMs
+    // while there are more than minThreads threads
+    struct timespec deadline = tp_idleDeadline(tp_);
+    bool reap = false;
+    while (tp_->running && tp_->waitingTasks.length == 0) {
+      errno = tp_waitForTask(tp_, &deadline);
+      if (errno == ETIMEDOUT) {
+        errno = 0;
+        if (tp_canReap(tp_)) {
+          reap = true;
+          break;
+        }
+        deadline = tp_idleDeadline(tp_);
+      } else if (errno != 0) {
+        fprintf(stderr,
+                "Encountered error while waiting on task to become available "
+                "in %s\n",
+                fooName);
+        return (void *)(size_t)errno;
+      }
+    }
+
+    // leave lock held after pthread_cond_wait to modify thread pool
+
+    // exit if reaped after idling
+    if (reap) {
+      errno = tp_retireThread(tp_);
+      const int retireErr = errno;
+      errno = pthread_mutex_unlock(&tp_->taskMutex);
+      if (errno != 0) {
+        fprintf(stderr,
+                "Encountered error while attempting to unlock mutex after "
+                "reaping idle thread in %s\n",
+                fooName);
+      } else {
+        errno = retireErr;
+      }
+      break;
+    }
+
+    // exit if forced to quit while idle w/o waiting task
+    if (!tp_->running && tp_->waitingTasks.length == 0) {
+      // release lock
+      errno = pthread_mutex_unlock(&tp_->taskMutex);
+      if (errno != 0) {
+        fprintf(stderr,
+                "Encountered error while attempting to unlock mutex after "
+                "waking idle thread in %s\n",
+                fooName);
+      }
+      break;
+    }
+
+    // decrement number of available threads
+    --tp_->numIdleThreads;
+
+    // Extract task to run
+    Task *const task = taskQueue_pop(&tp_->waitingTasks);
+
+    // release lock after modifying queues
+    errno = pthread_mutex_unlock(&tp_->taskMutex);
+    if (errno != 0) {
+      fprintf(
+          stderr,
+          "Encountered error while attempting to unlock mutex after modifying "
+          "thread pool's queues in %s\n",
+          fooName);
+      break;
+    }
+
+    // Run task, rescheduling it when periodic
+    errno = tp_runTask(tp_, task);
+    if (errno != 0) {
+      fprintf(stderr, "Failure running task in %s\n", fooName);
+      break;
+    }
+
+    // Obtain lock to update number of available tasks
+    errno = tp_lockTaskMutex(tp_);
+    if (errno != 0) {
+      fprintf(stderr,
+              "Encountered error while attempting to lock mutex to update idle "
+              "threads in %s\n",
+              fooName);
+      break;
+    }
+
+    ++tp_->numIdleThreads;
+
+    errno = pthread_mutex_unlock(&tp_->taskMutex);
+    if (errno != 0) {
+      fprintf(stderr,
+              "Encountered error while attempting to unlock mutex after "
+              "updating idle threads in %s\n",
+              fooName);
+      break;
+    }
+  }
+
+  return (void *)(size_t)errno;
+}
+
+void *timerFunction(void *tp) {
+  const char fooName[] = "timerFunction";
+
+  // Argument Validity Check
+  errno = 0;
+  if (tp == (void *)NULL) {
+    fprintf(stderr, "argument 'tp' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return (void *)(size_t)errno;
+  }
+
+  ThreadPool *const tp_ = (ThreadPool *)tp;
+
+  errno = pthread_mutex_lock(&tp_->timerMutex);
+  if (errno != 0) {
+    fprintf(stderr, "Failure locking timer mutex in %s\n", fooName);
+    return (void *)(size_t)errno;
+  }
+
+  while (tp_->timerRunning) {
+    // Hand every due task to the pool without holding the timer lock, since
+    // running tasks take it to reschedule themselves
+    Task *expired = tw_advance(tp_->timers, tp_nowMs());
+    if (expired != (Task *)NULL) {
+      errno = pthread_mutex_unlock(&tp_->timerMutex);
+      if (errno != 0) {
+        fprintf(stderr, "Failure unlocking timer mutex in %s\n", fooName);
+        return (void *)(size_t)errno;
+      }
+      while (expired != (Task *)NULL) {
+        Task *const next = expired->next;
+        if (atomic_load(&expired->cancelled)) {
+          tp_completeTask(tp_, expired);
+        } else if (tp_enqueueImmediate(tp_, expired) != 0) {
+          fprintf(stderr, "Failure enqueueing due task in %s\n", fooName);
+        }
+        expired = next;
+      }
+      errno = pthread_mutex_lock(&tp_->timerMutex);
+      if (errno != 0) {
+        fprintf(stderr, "Failure locking timer mutex in %s\n", fooName);
+        return (void *)(size_t)errno;
+      }
+      continue;
+    }
+
+    // Sleep until the wheel next needs turning or a task is scheduled
+    const uint64_t nextTick = tw_nextTick(tp_->timers);
+    tp_->timerWakeTick = nextTick;
+    if (nextTick == TW_NO_EXPIRY) {
+      errno = pthread_cond_wait(&tp_->timersChanged, &tp_->timerMutex);
+    } else {
+      const struct timespec deadline = {
+          .tv_sec = (time_t)(nextTick / 1000),
+          .tv_nsec = (long)(nextTick % 1000) * 1000000};
+      errno = pthread_cond_timedwait(&tp_->timersChanged, &tp_->timerMutex,
+                                     &deadline);
+    }
+    if (errno != 0 && errno != ETIMEDOUT) {
+      fprintf(stderr, "Failure waiting for timers to come due in %s\n",
+              fooName);
+      break;
+    }
+    errno = 0;
+  }
+
+  const int waitErr = errno;
+  errno = pthread_mutex_unlock(&tp_->timerMutex);
+  if (errno == 0) {
+    errno = waitErr;
+  }
+  return (void *)(size_t)errno;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <jd/threadpool.h>
+
+#include "task_queue.h"
+#include "timer_wheel.h"
+#include "ws_deque.h"
+
+// initial number of slots in each work-stealing deque
+#define TP_DEQUE_INIT_CAPACITY 64
+
+// bits of a Task's ownership word
+#define TP_TASK_HELD 1u     // queued in, scheduled in or being run by the pool
+#define TP_TASK_RELEASED 2u // given back through tp_releaseTask
+#define TP_TASK_FINISHING TASK_OWNERSHIP_FINISHING // let go of, still touched
+
+// Per-thread state of a work-stealing pool
+typedef struct TpWorker {
+  WsDeque deque;
+  ThreadPool *tp;
+  unsigned index;       // position in tp->workers
+  unsigned randomState; // xorshift state to pick victims
+  bool active;          // false once its thread is reaped; protected by taskMutex
+} TpWorker;
+
+bool tp_spawnThread(ThreadPool* const tp);
+
+/**
+ * @brief Current time of the monotonic clock
+ *
+ * @return uint64_t nanoseconds
+ */
+static uint64_t tp_nowNs();
+
+/**
+ * @brief Current time of the monotonic clock, in the milliseconds ticks of
+ * the pool's timer wheel
+ *
+ * @return uint64_t milliseconds
+ */
+static uint64_t tp_nowMs();
+
+/**
+ * @brief Locks tp's taskMutex. When built with JD_INSTRUMENT, also counts the
+ * lock, and whether and how long it blocked on another holder.
+ *
+ * @param tp thread pool
+ * @return int errno of pthread_mutex_lock
+ */
+static int tp_lockTaskMutex(ThreadPool *const tp);
+
+/**
+ * @brief Joins threads that exited after idling. Must hold taskMutex. Sets
+ * errno upon error.
+ *
+ * @param tp thread pool
+ * @return int errno
+ */
+static int tp_joinExited(ThreadPool *const tp);
+
+/**
+ * @brief Allocates and publishes a new work-stealing worker. Must hold
+ * taskMutex. Sets errno upon error.
+ *
+ * @param tp work-stealing thread pool
+ * @return TpWorker* new worker or NULL upon error
+ */
+static TpWorker *tp_newWorker(ThreadPool *const tp);
+
+/**
+ * @brief Pushes task onto the deque of worker, the calling thread, without
+ * locking. Only locks to spawn a thread when more tasks wait on the deques
+ * than threads idle. Sets errno only when task couldn't be pushed; failing
+ * to spawn or wake a thread once it's pushed is reported but not an error.
+ *
+ * @param tp thread pool worker belongs to
+ * @param worker state of the calling thread
+ * @param task task to enqueue
+ * @return int errno
+ */
+static int tp_enqueueLocal(ThreadPool *const tp, TpWorker *const worker,
+                           Task *const task);
+
+/**
+ * @brief Inserts task into tp's timer wheel at its timerExpiry, starting the
+ * timer thread on first use. Sets errno upon error, including ECANCELED once
+ * tp is being destroyed.
+ *
+ * @param tp thread pool
+ * @param task delayed or periodic task
+ * @return int errno
+ */
+static int tp_scheduleTimer(ThreadPool *const tp, Task *const task);
+
+/**
+ * @brief Completes every task left in tp's timer wheel with ECANCELED as its
+ * fooErrno, recycling those already released. Called by tp_destroy once
+ * nothing can be scheduled. Sets errno upon error.
+ *
+ * @param tp thread pool being destroyed
+ * @return int errno
+ */
+static int tp_cancelTimers(ThreadPool *const tp);
+
+/**
+ * @brief Marks task as held by the pool, deferring its recycling by
+ * tp_releaseTask until the pool lets go of it
+ *
+ * @param task task being queued or scheduled
+ */
+static void tp_holdTask(Task *const task);
+
+/**
+ * @brief Pushes the released task onto tp's freelist, or frees it when the
+ * freelist is full. Sets errno upon error.
+ *
+ * @param tp thread pool the task was acquired from
+ * @param task task neither held nor referenced by anyone
+ * @return int errno
+ */
+static int tp_recycleTask(ThreadPool *const tp, Task *const task);
+
+void *workerFunction(void* tp);
+
+/**
+ * @brief function of a thread pool's timer thread, which moves tasks from the
+ * timer wheel into the pool as they come due
+ *
+ * @param tp thread pool
+ * @return void* errno
+ */
+void *timerFunction(void *tp);
+
+/**
+ * @brief function each thread in a work-stealing pool runs to execute tasks
+ *
+ * @param worker TpWorker of the calling thread
+ * @return void* errno
+ */
+void *stealingWorkerFunction(void *worker);
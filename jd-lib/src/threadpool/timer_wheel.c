@@ -0,0 +1,159 @@
+/**
+ * @file timer_wheel.c
+ * @author Justen Di Ruscio
+ * @brief Definitions for a hierarchical timer wheel of Tasks, following
+ * Varghese and Lauck, "Hashed and Hierarchical Timing Wheels" (SOSP 1987)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "timer_wheel.h"
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Number of ticks spanned by one slot of level
+ *
+ * @param level level of the wheel
+ * @return uint64_t ticks
+ */
+static inline uint64_t tw_slotTicks(const unsigned level) {
+  return (uint64_t)1 << (TW_SLOT_BITS * level);
+}
+
+/**
+ * @brief Re-inserts every timer of the slot at the wheel's current position in
+ * level, moving them to lower levels
+ *
+ * @param tw wheel
+ * @param level level to cascade
+ * @return unsigned index of the cascaded slot
+ */
+static unsigned tw_cascade(TimerWheel *const tw, const unsigned level) {
+  const unsigned index =
+      (unsigned)(tw->current >> (TW_SLOT_BITS * level)) & TW_SLOT_MASK;
+  Task *task = tw->slots[level][index];
+  tw->slots[level][index] = (Task *)NULL;
+  while (task != (Task *)NULL) {
+    Task *const next = task->next;
+    --tw->size;
+    tw_insert(tw, task);
+    task = next;
+  }
+  return index;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+void tw_init(TimerWheel *const tw, const uint64_t now) {
+  tw->current = now;
+  tw->size = 0;
+  for (unsigned level = 0; level < TW_LEVELS; ++level) {
+    for (unsigned slot = 0; slot < TW_SLOTS; ++slot) {
+      tw->slots[level][slot] = (Task *)NULL;
+    }
+  }
+}
+
+void tw_insert(TimerWheel *const tw, Task *const task) {
+  const uint64_t expiry =
+      task->timerExpiry < tw->current ? tw->current : task->timerExpiry;
+  uint64_t delta = expiry - tw->current;
+
+  // park timers beyond the wheel's range at its furthest slot
+  uint64_t placedAt = expiry;
+  if (delta >= TW_MAX_TICKS) {
+    delta = TW_MAX_TICKS - 1;
+    placedAt = tw->current + delta;
+  }
+
+  unsigned level = 0;
+  while (level < TW_LEVELS - 1 && delta >= tw_slotTicks(level + 1)) {
+    ++level;
+  }
+  const unsigned index =
+      (unsigned)(placedAt >> (TW_SLOT_BITS * level)) & TW_SLOT_MASK;
+  task->next = tw->slots[level][index];
+  tw->slots[level][index] = task;
+  ++tw->size;
+}
+
+Task *tw_advance(TimerWheel *const tw, const uint64_t now) {
+  Task *expired = (Task *)NULL;
+
+  // nothing to expire or cascade, so jump straight to now
+  if (tw->size == 0) {
+    if (now >= tw->current) {
+      tw->current = now + 1;
+    }
+    return expired;
+  }
+
+  while (tw->current <= now) {
+    // cascade higher levels as each lower level wraps around
+    for (unsigned level = 1; level < TW_LEVELS; ++level) {
+      if ((tw->current & (tw_slotTicks(level) - 1)) != 0) {
+        break;
+      }
+      tw_cascade(tw, level);
+    }
+
+    const unsigned index = (unsigned)tw->current & TW_SLOT_MASK;
+    Task *task = tw->slots[0][index];
+    tw->slots[0][index] = (Task *)NULL;
+    while (task != (Task *)NULL) {
+      Task *const next = task->next;
+      --tw->size;
+      // parked timers that still lie beyond now go back into the wheel
+      if (task->timerExpiry > tw->current) {
+        tw_insert(tw, task);
+      } else {
+        task->next = expired;
+        expired = task;
+      }
+      task = next;
+    }
+    ++tw->current;
+  }
+  return expired;
+}
+
+uint64_t tw_nextTick(const TimerWheel *const tw) {
+  if (tw->size == 0) {
+    return TW_NO_EXPIRY;
+  }
+
+  // the cascade at a wrap hasn't happened until current is processed
+  if ((tw->current & TW_SLOT_MASK) == 0) {
+    return tw->current;
+  }
+
+  // a timer in the lowest level that expires before it wraps
+  const uint64_t wrapTick = (tw->current | TW_SLOT_MASK) + 1;
+  for (uint64_t tick = tw->current; tick < wrapTick; ++tick) {
+    if (tw->slots[0][tick & TW_SLOT_MASK] != (Task *)NULL) {
+      return tick;
+    }
+  }
+
+  // otherwise the next cascade may bring timers down into the lowest level
+  return wrapTick;
+}
+
+Task *tw_drain(TimerWheel *const tw) {
+  Task *drained = (Task *)NULL;
+  for (unsigned level = 0; level < TW_LEVELS; ++level) {
+    for (unsigned index = 0; index < TW_SLOTS; ++index) {
+      Task *task = tw->slots[level][index];
+      tw->slots[level][index] = (Task *)NULL;
+      while (task != (Task *)NULL) {
+        Task *const next = task->next;
+        task->next = drained;
+        drained = task;
+        task = next;
+      }
+    }
+  }
+  tw->size = 0;
+  return drained;
+}
@@ -0,0 +1,85 @@
+#pragma once
+/**
+ * @file timer_wheel.h
+ * @author Justen Di Ruscio
+ * @brief Declarations for a hierarchical timer wheel of Tasks. Each level holds
+ * TW_SLOTS slots, each slot spanning TW_SLOTS times the ticks of a slot in the
+ * level below. Timers are inserted into the lowest level whose range covers
+ * them and cascade down a level as the wheel turns, so inserting and expiring
+ * a timer are O(1).
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <jd/task.h>
+
+#define TW_LEVELS 4
+#define TW_SLOT_BITS 6
+#define TW_SLOTS (1 << TW_SLOT_BITS)
+#define TW_SLOT_MASK (TW_SLOTS - 1)
+// furthest a timer can be placed ahead of the wheel; later timers are parked
+// in the last level and re-placed when they cascade
+#define TW_MAX_TICKS ((uint64_t)1 << (TW_SLOT_BITS * TW_LEVELS))
+#define TW_NO_EXPIRY UINT64_MAX
+
+/**
+ * @brief Timers are Tasks linked through their next member and expiring
+ * at their timerExpiry tick
+ *
+ */
+typedef struct TimerWheel {
+  uint64_t current; // next tick to be processed
+  size_t size;      // number of contained timers
+  Task *slots[TW_LEVELS][TW_SLOTS];
+} TimerWheel;
+
+/**
+ * @brief Initializes an empty wheel
+ *
+ * @param tw wheel to initialize
+ * @param now first tick the wheel processes
+ */
+void tw_init(TimerWheel *const tw, const uint64_t now);
+
+/**
+ * @brief Inserts task to expire at its timerExpiry tick, or at the next
+ * processed tick when timerExpiry already passed
+ *
+ * @param tw wheel to insert into
+ * @param task timer to insert
+ */
+void tw_insert(TimerWheel *const tw, Task *const task);
+
+/**
+ * @brief Turns the wheel through tick now, collecting every timer that
+ * expired on the way
+ *
+ * @param tw wheel to advance
+ * @param now latest tick to process
+ * @return Task* expired timers linked through next, or NULL if none
+ */
+Task *tw_advance(TimerWheel *const tw, const uint64_t now);
+
+/**
+ * @brief Earliest tick the wheel needs to be advanced to, either to expire a
+ * timer or to cascade a higher level
+ *
+ * @param tw wheel
+ * @return uint64_t tick or TW_NO_EXPIRY when the wheel is empty
+ */
+uint64_t tw_nextTick(const TimerWheel *const tw);
+
+/**
+ * @brief Removes every timer from the wheel, whether expired or not
+ *
+ * @param tw wheel to empty
+ * @return Task* removed timers linked through next, or NULL if none
+ */
+Task *tw_drain(TimerWheel *const tw);
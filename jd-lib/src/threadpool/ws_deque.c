@@ -0,0 +1,198 @@
+/**
+ * @file ws_deque.c
+ * @author Justen Di Ruscio
+ * @brief Definitions for a Chase-Lev work-stealing deque of Tasks. Memory
+ * orderings follow Le et al., "Correct and Efficient Work-Stealing for Weak
+ * Memory Models" (PPoPP 2013).
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "ws_deque.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// ==================== PRIVATE FUNCTIONS ===============
+/**
+ * @brief Allocates a buffer with the provided number of slots. Sets errno upon
+ * error.
+ *
+ * @param capacity number of slots; must be a power of two
+ * @return WsBuffer* allocated buffer or NULL upon error
+ */
+static WsBuffer *wsBuffer_new(const long capacity) {
+  const char fooName[] = "wsBuffer_new";
+
+  WsBuffer *const buffer =
+      malloc(sizeof(WsBuffer) + (size_t)capacity * sizeof(_Atomic(Task *)));
+  if (buffer == (WsBuffer *)NULL) {
+    fprintf(stderr, "Failure allocating work-stealing buffer of %ld in %s\n",
+            capacity, fooName);
+    return (WsBuffer *)NULL; // errno set by malloc
+  }
+  buffer->capacity = capacity;
+  buffer->retired = (WsBuffer *)NULL;
+  return buffer;
+}
+
+static inline Task *wsBuffer_get(WsBuffer *const buffer, const long index) {
+  return atomic_load_explicit(&buffer->slots[index & (buffer->capacity - 1)],
+                              memory_order_relaxed);
+}
+
+static inline void wsBuffer_put(WsBuffer *const buffer, const long index,
+                                Task *const task) {
+  atomic_store_explicit(&buffer->slots[index & (buffer->capacity - 1)], task,
+                        memory_order_relaxed);
+}
+
+/**
+ * @brief Replaces the deque's buffer with one twice as large, copying over the
+ * live range [top, bottom). Only called by the owner. Sets errno upon error.
+ *
+ * @param dq deque to grow
+ * @param old current buffer of dq
+ * @param top current top index
+ * @param bottom current bottom index
+ * @return WsBuffer* new buffer or NULL upon error
+ */
+static WsBuffer *wsDeque_grow(WsDeque *const dq, WsBuffer *const old,
+                              const long top, const long bottom) {
+  WsBuffer *const grown = wsBuffer_new(old->capacity * 2);
+  if (grown == (WsBuffer *)NULL) {
+    return (WsBuffer *)NULL; // errno set by wsBuffer_new
+  }
+  for (long i = top; i < bottom; ++i) {
+    wsBuffer_put(grown, i, wsBuffer_get(old, i));
+  }
+  grown->retired = old;
+  atomic_store_explicit(&dq->buffer, grown, memory_order_release);
+  return grown;
+}
+
+// ==================== PUBLIC FUNCTIONS ===============
+bool wsDeque_init(WsDeque *const dq, const long capacity) {
+  const char fooName[] = "wsDeque_init";
+
+  // Argument Validity Check
+  errno = 0;
+  if (dq == (WsDeque *)NULL) {
+    fprintf(stderr, "argument 'dq' of %s must point to a valid address\n",
+            fooName);
+    errno = EPERM;
+    return false;
+  }
+
+  // round capacity to a power of two so indices can be masked
+  long roundedCapacity = 1;
+  while (roundedCapacity < capacity) {
+    roundedCapacity <<= 1;
+  }
+
+  WsBuffer *const buffer = wsBuffer_new(roundedCapacity);
+  if (buffer == (WsBuffer *)NULL) {
+    return false; // errno set by wsBuffer_new
+  }
+  atomic_init(&dq->top, 0);
+  atomic_init(&dq->bottom, 0);
+  atomic_init(&dq->buffer, buffer);
+  return true;
+}
+
+void wsDeque_destroy(WsDeque *const dq) {
+  // Return if there's nothing to destroy
+  if (dq == (WsDeque *)NULL) {
+    return;
+  }
+
+  WsBuffer *buffer = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+  while (buffer != (WsBuffer *)NULL) {
+    WsBuffer *const retired = buffer->retired;
+    free(buffer);
+    buffer = retired;
+  }
+  atomic_store_explicit(&dq->buffer, (WsBuffer *)NULL, memory_order_relaxed);
+}
+
+bool wsDeque_push(WsDeque *const dq, Task *const task) {
+  const long bottom = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+  const long top = atomic_load_explicit(&dq->top, memory_order_acquire);
+  WsBuffer *buffer = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+
+  // grow when full
+  if (bottom - top > buffer->capacity - 1) {
+    buffer = wsDeque_grow(dq, buffer, top, bottom);
+    if (buffer == (WsBuffer *)NULL) {
+      return false; // errno set by wsDeque_grow
+    }
+  }
+
+  // release publishes task to thieves; seq_cst under thread sanitizer, for
+  // the handshake with sleeping workers in tp_wakeSleeper
+  wsBuffer_put(buffer, bottom, task);
+  atomic_store_explicit(&dq->bottom, bottom + 1,
+                        WS_FENCED(memory_order_release));
+  return true;
+}
+
+Task *wsDeque_pop(WsDeque *const dq) {
+  const long bottom =
+      atomic_load_explicit(&dq->bottom, memory_order_relaxed) - 1;
+  WsBuffer *const buffer =
+      atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+  atomic_store_explicit(&dq->bottom, bottom, WS_FENCED(memory_order_relaxed));
+  WS_SEQ_CST_FENCE();
+  long top = atomic_load_explicit(&dq->top, WS_FENCED(memory_order_relaxed));
+
+  // deque was empty; restore bottom
+  if (top > bottom) {
+    atomic_store_explicit(&dq->bottom, bottom + 1, memory_order_relaxed);
+    return (Task *)NULL;
+  }
+
+  Task *task = wsBuffer_get(buffer, bottom);
+  // last element; race thieves for it through top
+  if (top == bottom) {
+    const bool won = atomic_compare_exchange_strong_explicit(
+        &dq->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+    if (!won) {
+      task = (Task *)NULL;
+    }
+    atomic_store_explicit(&dq->bottom, bottom + 1, memory_order_relaxed);
+  }
+  return task;
+}
+
+Task *wsDeque_steal(WsDeque *const dq, bool *const lostRace) {
+  *lostRace = false;
+  long top = atomic_load_explicit(&dq->top, WS_FENCED(memory_order_acquire));
+  WS_SEQ_CST_FENCE();
+  const long bottom =
+      atomic_load_explicit(&dq->bottom, WS_FENCED(memory_order_acquire));
+
+  // nothing to steal
+  if (top >= bottom) {
+    return (Task *)NULL;
+  }
+
+  WsBuffer *const buffer =
+      atomic_load_explicit(&dq->buffer, memory_order_acquire);
+  Task *const task = wsBuffer_get(buffer, top);
+  const bool won = atomic_compare_exchange_strong_explicit(
+      &dq->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+  if (!won) {
+    *lostRace = true;
+    return (Task *)NULL;
+  }
+  return task;
+}
+
+long wsDeque_size(WsDeque *const dq) {
+  const long bottom = atomic_load_explicit(&dq->bottom, memory_order_seq_cst);
+  const long top = atomic_load_explicit(&dq->top, memory_order_seq_cst);
+  return bottom > top ? bottom - top : 0;
+}
@@ -0,0 +1,118 @@
+#pragma once
+/**
+ * @file ws_deque.h
+ * @author Justen Di Ruscio
+ * @brief Declarations for a Chase-Lev work-stealing deque of Tasks. The owning
+ * worker pushes and pops at the bottom (LIFO) without locking, while other
+ * workers steal from the top (FIFO) with a single CAS.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include <jd/task.h>
+
+#define WS_CACHE_LINE 64
+
+// Thread sanitizer can't model atomic_thread_fence, and would miss races the
+// fences rule out. Under it, the accesses a seq_cst fence orders are seq_cst
+// themselves instead, as in the original Chase-Lev deque
+#if defined(__SANITIZE_THREAD__)
+#define WS_NO_FENCES 1
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define WS_NO_FENCES 1
+#endif
+#endif
+
+#if defined(WS_NO_FENCES)
+#define WS_SEQ_CST_FENCE() ((void)0)
+#define WS_FENCED(order) memory_order_seq_cst
+#else
+#define WS_SEQ_CST_FENCE() atomic_thread_fence(memory_order_seq_cst)
+#define WS_FENCED(order) (order) // order of an access a fence orders
+#endif
+
+/**
+ * @brief Circular array backing a WsDeque. Replaced buffers are chained
+ * through retired and kept alive until the deque is destroyed, since thieves
+ * may still be reading from them.
+ *
+ */
+typedef struct WsBuffer {
+  long capacity; // power of two
+  struct WsBuffer *retired;
+  _Atomic(Task *) slots[];
+} WsBuffer;
+
+// top and bottom are padded apart so thieves CASing top don't invalidate the
+// owner's cache line holding bottom
+typedef struct WsDeque {
+  atomic_long top; // stolen from by other workers
+  char topPadding[WS_CACHE_LINE - sizeof(atomic_long)];
+  atomic_long bottom; // pushed/popped by owner
+  _Atomic(WsBuffer *) buffer;
+} WsDeque;
+
+/**
+ * @brief Initializes an empty deque. Sets errno upon error.
+ *
+ * @param dq deque to initialize
+ * @param capacity initial number of slots; rounded up to a power of two
+ * @return true successfully initialized deque
+ * @return false failed to allocate the deque's buffer
+ */
+bool wsDeque_init(WsDeque *const dq, const long capacity);
+
+/**
+ * @brief Frees the deque's current and retired buffers. Tasks still contained
+ * in the deque are not touched.
+ *
+ * @param dq deque to destroy
+ */
+void wsDeque_destroy(WsDeque *const dq);
+
+/**
+ * @brief Pushes task onto the bottom of the deque, growing its buffer when
+ * full. Must only be called by the owning worker. Sets errno upon error.
+ *
+ * @param dq deque to push onto
+ * @param task task to push
+ * @return true successfully pushed task
+ * @return false failed to grow the deque's buffer
+ */
+bool wsDeque_push(WsDeque *const dq, Task *const task);
+
+/**
+ * @brief Pops the most recently pushed task from the bottom of the deque. Must
+ * only be called by the owning worker.
+ *
+ * @param dq deque to pop from
+ * @return Task* popped task or NULL if the deque is empty
+ */
+Task *wsDeque_pop(WsDeque *const dq);
+
+/**
+ * @brief Steals the oldest task from the top of the deque. May be called by
+ * any thread.
+ *
+ * @param dq deque to steal from
+ * @param lostRace out-parameter set to true when a task was present but
+ * another thread claimed it first, so the caller may retry
+ * @return Task* stolen task or NULL if nothing was stolen
+ */
+Task *wsDeque_steal(WsDeque *const dq, bool *const lostRace);
+
+/**
+ * @brief Approximate number of tasks in the deque. Exact only when the deque
+ * isn't being modified concurrently.
+ *
+ * @param dq deque to measure
+ * @return long number of contained tasks
+ */
+long wsDeque_size(WsDeque *const dq);
@@ -11,7 +11,9 @@
  */
 
 #include "vector_private.h"
+#include <jd/arena.h>
 #include <jd/error.h>
+#include <jd/instrument.h>
 #include <jd/string.h>
 #include <jd/vector.h>
 
@@ -24,17 +26,26 @@ Vector vector_constructEmpty(const size_t dataSize) {
                 .length = 0,
                 .capacity = 0,
                 .elementDeleter = NULL,
-                .dataSize = dataSize};
+                .dataSize = dataSize,
+                .arena = (struct Arena *)NULL};
   return vec;
 }
 
 OptionalVector vector_constructCapacity(const size_t capacity,
                                         const size_t dataSize) {
-  const char fooName[] = "vector_constructCapacity";
+  return vector_constructCapacityArena(capacity, dataSize,
+                                       (struct Arena *)NULL);
+}
+
+OptionalVector vector_constructCapacityArena(const size_t capacity,
+                                             const size_t dataSize,
+                                             struct Arena *const arena) {
+  const char fooName[] = "vector_constructCapacityArena";
   Vector vec = {.data = (void *)NULL,
                 .length = 0,
                 .capacity = capacity,
-                .dataSize = dataSize};
+                .dataSize = dataSize,
+                .arena = arena};
   OptionalVector result = {.data = vec, .valid = false};
 
   // Argument Validity Checks
@@ -53,13 +64,18 @@ OptionalVector vector_constructCapacity(const size_t capacity,
   }
 
   // Construction
-  void *const newVectorBuff = malloc(capacity * dataSize);
+  void *const newVectorBuff = arena != (struct Arena *)NULL
+                                  ? arena_alloc(arena, capacity * dataSize)
+                                  : malloc(capacity * dataSize);
   if (newVectorBuff == (void *)NULL) {
     fprintf(stderr,
             "failure allocating memory for vector contents in "
             "%s\n",
             fooName);
-    return result; // errno set by malloc
+    return result; // errno set by malloc or arena_alloc
+  }
+  if (arena == (struct Arena *)NULL) {
+    JD_COUNT_ALLOCATION(capacity * dataSize);
   }
   vec.data = newVectorBuff;
   result.valid = true;
@@ -86,14 +102,21 @@ OptionalVector vector_copyConstruct(const Vector *const other) {
   Vector vec = {.data = (void *)NULL,
                 .length = other->length,
                 .capacity = other->capacity,
-                .dataSize = other->dataSize};
-  void *const newVectorBuff = malloc(vec.capacity * vec.dataSize);
+                .dataSize = other->dataSize,
+                .arena = other->arena};
+  const size_t buffSize = vec.capacity * vec.dataSize;
+  void *const newVectorBuff = vec.arena != (struct Arena *)NULL
+                                  ? arena_alloc(vec.arena, buffSize)
+                                  : malloc(buffSize);
   if (newVectorBuff == (void *)NULL) {
     fprintf(stderr,
             "failure allocating memory for vector contents in "
             "%s\n",
             fooName);
-    return result; // errno set by malloc
+    return result; // errno set by malloc or arena_alloc
+  }
+  if (vec.arena == (struct Arena *)NULL) {
+    JD_COUNT_ALLOCATION(buffSize);
   }
   vec.data = newVectorBuff;
   memcpy(vec.data, other->data, vec.length * vec.dataSize);
@@ -104,8 +127,8 @@ OptionalVector vector_copyConstruct(const Vector *const other) {
 }
 
 void vector_freeData(const Vector *const vec) {
-  // Return if there's nothing to free
-  if (vec == (Vector *)NULL) {
+  // Return if there's nothing to free, including data owned by an arena
+  if (vec == (Vector *)NULL || vec->arena != (struct Arena *)NULL) {
     return;
   }
   // Free data member
@@ -129,7 +152,7 @@ void vector_freeElements(const Vector *const vec) {
   }
 
   for (size_t elementIdx = 0; elementIdx < vec->length; ++elementIdx) {
-    const void *const element = vector_at(vec, elementIdx);
+    const void *const element = vector_atUnchecked(vec, elementIdx);
     vec->elementDeleter(element);
   }
 }
@@ -303,11 +326,18 @@ bool vector_reserve(Vector *const vec, const size_t newSize) {
   // Reserve
   if (newSize > vec->capacity) { // require resize
     const size_t newCapacity = 2 * newSize;
-    void *newVectorBuffer = realloc(vec->data, newCapacity * vec->dataSize);
+    void *newVectorBuffer =
+        vec->arena != (struct Arena *)NULL
+            ? arena_grow(vec->arena, vec->data, vec->capacity * vec->dataSize,
+                         newCapacity * vec->dataSize)
+            : realloc(vec->data, newCapacity * vec->dataSize);
     if (newVectorBuffer == (void *)NULL) { // realloc failed
       fprintf(stderr, "resizing vector buffer with realloc failed in %s\n",
               fooName);
-      return false; // realloc sets errno
+      return false; // realloc or arena_grow sets errno
+    }
+    if (vec->arena == (struct Arena *)NULL) {
+      JD_COUNT_ALLOCATION(newCapacity * vec->dataSize);
     }
     vec->data = newVectorBuffer;
     vec->capacity = newCapacity;
@@ -467,7 +497,7 @@ bool vector_erase(Vector *const vec, const size_t index) {
   // Erase Element
   // create new vector to store elements
   OptionalVector newOpt =
-      vector_constructCapacity(vec->capacity, vec->dataSize);
+      vector_constructCapacityArena(vec->capacity, vec->dataSize, vec->arena);
   if (!newOpt.valid) {
     fprintf(stderr,
             "Unable to construct vector in %s to store retained elements\n",
@@ -523,7 +553,7 @@ ssize_t vector_find(const Vector *const vec, const void *const value) {
 
   // Find element
   for (unsigned i = 0; i < vec->length; ++i) {
-    const void *const vecElem = vector_at(vec, i);
+    const void *const vecElem = vector_atUnchecked(vec, i);
     if (memcmp(vecElem, value, vec->dataSize) == 0) {
       foundIndex = i;
       break;